@@ -0,0 +1,66 @@
+#ifndef APP_MANAGER_H
+#define APP_MANAGER_H
+
+#include <Arduino.h>
+
+// Eine App, die sich mit anderen das Board teilt. Es läuft immer nur eine,
+// alle teilen sich den Stack von loop(), statt jede mit eigenem Task, und
+// zeichnen in denselben Framebuffer (pixelBoard).
+class App {
+public:
+    virtual ~App() {}
+
+    virtual const char *name() const = 0;
+
+    // Beim Laden: Zustand aus dem letzten stop() übernehmen oder neu beginnen.
+    // Auf dem Board steht noch das Bild der vorherigen App, also ganz neu zeichnen.
+    virtual void start(unsigned long jetzt) {}
+
+    // Ein kurzer Arbeitsschritt, darf nie warten (kein delay)
+    virtual void schritt(unsigned long jetzt) = 0;
+
+    // Beim Entladen: was beim nächsten start() weitergehen soll, bleibt im Objekt
+    virtual void stop() {}
+};
+
+// Hält die registrierten Apps und lässt genau eine davon laufen. Kein
+// fl::Scheduler: der kennt kein Laden und Entladen, jeder Wechsel wäre ein
+// cancel() und ein neuer Task auf dem Heap, und start()/stop() fehlen.
+template <uint8_t tMaxApps>
+class AppManager {
+public:
+    // false wenn kein Platz mehr ist
+    bool registriere(App &app) {
+        if (anzahl >= tMaxApps) return false;
+        apps[anzahl++] = &app;
+        return true;
+    }
+
+    // Erste App laden
+    void begin(unsigned long jetzt) {
+        if (anzahl == 0) return;
+        aktiv = 0;
+        apps[aktiv]->start(jetzt);
+    }
+
+    // Aktuelle App entladen, die nächste laden
+    void wechsle(unsigned long jetzt) {
+        if (anzahl == 0) return;
+        apps[aktiv]->stop();
+        aktiv = (aktiv + 1) % anzahl;
+        apps[aktiv]->start(jetzt);
+    }
+
+    void schritt(unsigned long jetzt) {
+        if (anzahl > 0) apps[aktiv]->schritt(jetzt);
+    }
+
+    App &aktiveApp() { return *apps[aktiv]; }
+
+private:
+    App *apps[tMaxApps];
+    uint8_t anzahl = 0;
+    uint8_t aktiv = 0;
+};
+
+#endif
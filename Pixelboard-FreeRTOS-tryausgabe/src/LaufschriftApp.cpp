@@ -0,0 +1,78 @@
+#include "LaufschriftApp.h"
+#include <FontMatrise.h>
+
+#define SCROLL_MS           10   // Bildabstand in Modus 0-4 (kleiner = schneller)
+#define WEICH_FRAME_MS       8   // Bildabstand in Modus 5/6 (~125 FPS)
+#define PIXEL_PRO_SEKUNDE   20   // Geschwindigkeit in Modus 5/6
+
+void LaufschriftApp::begin() {
+    // Oben/Unten
+    scrollingText.SetFont(MatriseFontData);
+    scrollingText.Init(&canvas, canvas.Width(), canvas.Height(), 0, 0);
+    scrollingText.SetTextColrOptions(COLR_RGB | COLR_SINGLE, textFarbe.r, textFarbe.g, textFarbe.b);
+    scrollingText.SetText((unsigned char *)textInhalt, strlen(textInhalt));
+    if (textModus == 3) scrollingText.SetScrollDirection(SCROLL_UP);
+    if (textModus == 4) scrollingText.SetScrollDirection(SCROLL_DOWN);
+
+    // Ticker: Glyphen einmal rastern und den ganzen Text als Streifen ablegen
+    tickerText.SetFont(MatriseFontData);
+    tickerText.Init(&canvas, canvas.Width(), canvas.Height(), 0, 0);
+    tickerText.SetTextColour(textFarbe);
+    if (tickerText.SetText((const unsigned char *)textInhalt, strlen(textInhalt)) < 0) {
+        Serial.println(F("Text zu lang fuer den Ticker-Streifen"));
+    }
+    const bool rechts = (textModus == 2 || textModus == 6);
+    tickerText.SetScrollDirection(rechts ? SCROLL_RIGHT : SCROLL_LEFT);
+}
+
+void LaufschriftApp::start(unsigned long jetzt) {
+    // Im Canvas steht noch die vorherige App
+    loescheCanvas();
+    statischGezeichnet = false;
+    // Die Zeit in anderen Apps zählt nicht als gefahrene Strecke
+    weichStart += jetzt - gestopptBei;
+}
+
+void LaufschriftApp::stop() {
+    gestopptBei = millis();
+}
+
+void LaufschriftApp::schritt(unsigned long jetzt) {
+    // Modus 5/6 zeichnet im festen Bildtakt, die Textposition folgt der Zeit
+    const bool weich = (textModus == 5 || textModus == 6);
+    const uint32_t bildAbstand = weich ? WEICH_FRAME_MS : SCROLL_MS;
+    if (jetzt - letzterFrame < bildAbstand) return;
+    letzterFrame = jetzt;
+
+    // --- SCHRITT 1: Text Update (Virtuelle 8px Ebene) ---
+    if (textModus == 0) {
+        // STATISCH: Streifen an den Textanfang setzen und einmal zeichnen
+        if (!statischGezeichnet) {
+            tickerText.SetOffset(0);
+            tickerText.Draw();
+            statischGezeichnet = true;
+        }
+    }
+    else if (textModus == 1 || textModus == 2) {
+        // LAUFSCHRIFT LINKS/RECHTS: nur Versatz im Streifen weiterschieben,
+        // am Textende geht es nahtlos mit dem Anfang weiter
+        tickerText.UpdateText();
+    }
+    else if (weich) {
+        // WEICHE LAUFSCHRIFT: Strecke seit dem Start in 1/256 Pixel, der Text
+        // steht dazwischen und wird aus zwei Nachbarspalten überblendet
+        const uint64_t strecke = (uint64_t)(jetzt - weichStart) * PIXEL_PRO_SEKUNDE * 256 / 1000;
+        const uint64_t laenge = (uint64_t)tickerText.TextColumns() << 8;
+        if (laenge > 0) tickerText.DrawFract(strecke % laenge);
+    }
+    else {
+        // BEWEGUNG (Modus 3-4), -1: Text ist einmal komplett durchgelaufen
+        if (scrollingText.UpdateText() == -1) {
+            scrollingText.SetText((unsigned char *)textInhalt, strlen(textInhalt));
+        }
+    }
+
+    // --- SCHRITT 2: Skalieren, Verschieben & auf Panels mappen (ein Durchlauf) ---
+    pixelBoard.zeigeCanvas(canvasAbbildung, canvasLeds);
+    pixelBoard.show();
+}
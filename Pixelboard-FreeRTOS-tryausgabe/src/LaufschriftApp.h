@@ -0,0 +1,46 @@
+#ifndef LAUFSCHRIFT_APP_H
+#define LAUFSCHRIFT_APP_H
+
+#include <FastLED.h>
+#include <LEDMatrix.h>
+#include <LEDText.h>
+#include <LEDTextStrip.h>
+#include "AppManager.h"
+#include "TextCanvas.h"
+
+// Laufschrift aus Pixelboard-LED-Schrift mit denselben Modi:
+// 0 = Statisch
+// 1 = Laufschrift nach LINKS, 2 = nach RECHTS
+// 3 = Laufschrift nach OBEN, 4 = nach UNTEN
+// 5 = Weiche Laufschrift nach LINKS, 6 = nach RECHTS (zeitbasiert, Zwischenpositionen)
+// Die weiche Laufschrift steht nach dem Wechsel in eine andere App still und
+// läuft beim Laden an derselben Stelle weiter.
+class LaufschriftApp : public App {
+public:
+    LaufschriftApp(const char *text, const CRGB &farbe, uint8_t modus)
+        : textInhalt(text), textFarbe(farbe), textModus(modus) {}
+
+    // Einmal in setup(), nach initCanvas()
+    void begin();
+
+    const char *name() const override { return "Laufschrift"; }
+    void start(unsigned long jetzt) override;
+    void schritt(unsigned long jetzt) override;
+    void stop() override;
+
+private:
+    const char *textInhalt;
+    CRGB textFarbe;
+    uint8_t textModus;
+
+    // Links/Rechts und statisch: vorgerasterter Streifen, Aufwand unabhängig
+    // von der Textlänge. Oben/Unten: klassisches cLEDText.
+    cLEDTextStrip<1024> tickerText;
+    cLEDText scrollingText;
+    uint32_t letzterFrame = 0;
+    uint32_t weichStart = 0;
+    uint32_t gestopptBei = 0;
+    bool statischGezeichnet = false;
+};
+
+#endif
@@ -0,0 +1,165 @@
+#include "SnakeApp.h"
+#include <PixelBoard.h>
+
+#define SPIELFELD_BREITE  PixelBoard::BREITE
+#define SPIELFELD_HOEHE   PixelBoard::HOEHE
+#define GAME_OVER_MS      1200   // so lange bleibt das rote Bild stehen
+
+static_assert(SPIELFELD_BREITE * SPIELFELD_HOEHE <= MAX_BOARD_CELLS,
+              "Spielfeld passt nicht in das OccupancyGrid von SnakeGame");
+
+SnakeApp::SnakeApp(Joystick &joystick)
+    : joystick(joystick), game(SPIELFELD_BREITE, SPIELFELD_HOEHE), spielTakt(400) {}
+
+void SnakeApp::begin(uint32_t seed) {
+    game.seed(seed);
+}
+
+void SnakeApp::start(unsigned long jetzt) {
+    // Takt neu beginnen, sonst holt ein laufendes Spiel die Zeit in den
+    // anderen Apps nach. Auf dem Board steht noch deren Bild.
+    spielTakt.start(jetzt);
+    anzahlDrehungen = 0;
+    if (zustand == GAME_OVER) zustand = MENUE;
+    neuZeichnen = true;
+}
+
+void SnakeApp::schritt(unsigned long jetzt) {
+    switch (zustand) {
+        case MENUE:
+            bearbeiteMenue(jetzt);
+            break;
+
+        case SPIEL:
+            bearbeiteSpiel(jetzt);
+            break;
+
+        case GAME_OVER:
+            // Tastendrücke während Game Over verwerfen, dann zurück ins Menü
+            joystick.wurdeGedrueckt();
+            if (jetzt - gameOverSeit >= GAME_OVER_MS) {
+                zustand = MENUE;
+                neuZeichnen = true;
+            }
+            break;
+    }
+
+    // Nur bei geändertem Bild zeichnen und senden
+    if (neuZeichnen) {
+        zeichne();
+        pixelBoard.show();
+        neuZeichnen = false;
+    }
+}
+
+void SnakeApp::bearbeiteMenue(unsigned long jetzt) {
+    if (joystick.neueRichtungOben()) {
+        menueAuswahl = 0;
+        neuZeichnen = true;
+    }
+    if (joystick.neueRichtungUnten()) {
+        menueAuswahl = 1;
+        neuZeichnen = true;
+    }
+
+    // Links/Rechts ändert den ausgewählten Wert
+    int8_t aenderung = 0;
+    if (joystick.neueRichtungRechts()) aenderung = 1;
+    if (joystick.neueRichtungLinks()) aenderung = -1;
+    if (aenderung != 0) {
+        uint8_t &wert = (menueAuswahl == 0) ? tempo : futter;
+        const uint8_t maximum = (menueAuswahl == 0) ? 5 : MAX_FOOD;
+        if (wert + aenderung >= 1 && wert + aenderung <= maximum) {
+            wert += aenderung;
+            neuZeichnen = true;
+        }
+    }
+
+    if (joystick.wurdeGedrueckt()) {
+        game.reset(futter);
+        spielTakt.setStep(400 - (tempo * 60));
+        spielTakt.start(jetzt);
+        anzahlDrehungen = 0;
+        zustand = SPIEL;
+        neuZeichnen = true;
+    }
+}
+
+void SnakeApp::bearbeiteSpiel(unsigned long jetzt) {
+    merkeDrehung();
+
+    // Fällige Schritte abarbeiten, jeder mit höchstens einer Drehung
+    uint8_t schritte = spielTakt.dueSteps(jetzt);
+    for (uint8_t i = 0; i < schritte && zustand == SPIEL; i++) {
+        uebernehmeNaechsteDrehung();
+        if (!game.update()) {
+            zustand = GAME_OVER;
+            gameOverSeit = jetzt;
+        }
+    }
+    if (schritte > 0) neuZeichnen = true;
+}
+
+void SnakeApp::merkeDrehung() {
+    Direction d;
+    if (joystick.neueRichtungOben()) d = DIR_UP;
+    else if (joystick.neueRichtungUnten()) d = DIR_DOWN;
+    else if (joystick.neueRichtungLinks()) d = DIR_LEFT;
+    else if (joystick.neueRichtungRechts()) d = DIR_RIGHT;
+    else return;
+
+    if (anzahlDrehungen < MAX_DREHUNGEN) drehungen[anzahlDrehungen++] = d;
+}
+
+// Eine gültige Drehung pro Spielschritt, weitere bleiben für die nächsten
+// Schritte (z.B. schnelles Oben-Links für eine Kehre)
+void SnakeApp::uebernehmeNaechsteDrehung() {
+    uint8_t gelesen = 0;
+    while (gelesen < anzahlDrehungen) {
+        if (game.setDirection(drehungen[gelesen++])) break;
+    }
+    anzahlDrehungen -= gelesen;
+    memmove(drehungen, drehungen + gelesen, anzahlDrehungen * sizeof(Direction));
+}
+
+void SnakeApp::zeichne() {
+    const int rechts = SPIELFELD_BREITE - 1;
+    const int unten = SPIELFELD_HOEHE - 1;
+
+    pixelBoard.clear();
+    if (zustand == MENUE) {
+        // Rahmen im Menü
+        for (int x = 0; x <= rechts; x++) {
+            pixelBoard.setPixel(x, 0, CRGB::White);
+            pixelBoard.setPixel(x, unten, CRGB::White);
+        }
+        // Tempo-Balken (Blau)
+        for (int i = 0; i < tempo; i++) pixelBoard.setPixel(8 + i * 2, 5, CRGB::Blue);
+        if (menueAuswahl == 0) pixelBoard.setPixel(5, 5, CRGB::White);
+        // Futter-Balken (Rot)
+        for (int i = 0; i < futter; i++) pixelBoard.setPixel(8 + i * 2, 10, CRGB::Red);
+        if (menueAuswahl == 1) pixelBoard.setPixel(5, 10, CRGB::White);
+    }
+    else if (zustand == SPIEL) {
+        // Weißer Rand
+        for (int x = 0; x <= rechts; x++) {
+            pixelBoard.setPixel(x, 0, CRGB::White);
+            pixelBoard.setPixel(x, unten, CRGB::White);
+        }
+        for (int y = 0; y <= unten; y++) {
+            pixelBoard.setPixel(0, y, CRGB::White);
+            pixelBoard.setPixel(rechts, y, CRGB::White);
+        }
+        // Futter & Schlange, ein volles Feld hat Futter bei (-1, -1)
+        for (int i = 0; i < game.getCurrentFoodCount(); i++) {
+            const Point &f = game.getFoodArray()[i];
+            pixelBoard.setPixel(f.x, f.y, CRGB::Red);
+        }
+        for (Segment s : game.getBody()) pixelBoard.setPixel(s.x, s.y, CRGB::Green);
+        const Segment kopf = game.getBody().head();
+        pixelBoard.setPixel(kopf.x, kopf.y, CRGB::Lime);
+    }
+    else {
+        fill_solid(pixelBoard.leds(), PixelBoard::ANZAHL_LEDS, CRGB::Red);
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef SNAKE_APP_H
+#define SNAKE_APP_H
+
+#include "AppManager.h"
+#include "Joystick.h"
+#include "FixedTimestep.h"
+#include "SnakeGame.h"
+
+// Snake aus snake_game mit demselben Spielkern, aber ohne eigene Tasks:
+// Eingabe, Spielschritt und Zeichnen laufen nacheinander in schritt().
+// Ein laufendes Spiel bleibt beim Entladen stehen und geht beim Laden weiter.
+class SnakeApp : public App {
+public:
+    explicit SnakeApp(Joystick &joystick);
+
+    // Einmal in setup(): Zufall für die Futterplätze
+    void begin(uint32_t seed);
+
+    const char *name() const override { return "Snake"; }
+    void start(unsigned long jetzt) override;
+    void schritt(unsigned long jetzt) override;
+
+private:
+    enum Zustand { MENUE, SPIEL, GAME_OVER };
+    static const uint8_t MAX_DREHUNGEN = 4;
+
+    void bearbeiteMenue(unsigned long jetzt);
+    void bearbeiteSpiel(unsigned long jetzt);
+    void merkeDrehung();
+    void uebernehmeNaechsteDrehung();
+    void zeichne();
+
+    Joystick &joystick;
+    SnakeGame game;
+    FixedTimestep spielTakt;
+    Zustand zustand = MENUE;
+    uint8_t menueAuswahl = 0;   // 0 = Tempo, 1 = Futter
+    uint8_t tempo = 2;          // 1..5
+    uint8_t futter = 1;         // 1..MAX_FOOD
+    unsigned long gameOverSeit = 0;
+    bool neuZeichnen = true;
+
+    // Joystick-Flanken seit dem letzten Spielschritt, älteste zuerst
+    Direction drehungen[MAX_DREHUNGEN];
+    uint8_t anzahlDrehungen = 0;
+};
+
+#endif
@@ -0,0 +1,9 @@
+#include "TextCanvas.h"
+
+CRGB canvasLeds[CANVAS_BREITE * CANVAS_HOEHE];
+cLEDMatrix<CANVAS_BREITE, CANVAS_HOEHE, HORIZONTAL_MATRIX> canvas;
+
+void initCanvas() {
+  canvas.SetLEDArray(canvasLeds);
+  loescheCanvas();
+}
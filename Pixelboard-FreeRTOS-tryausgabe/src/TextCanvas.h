@@ -0,0 +1,37 @@
+/**
+ * @file TextCanvas.h
+ * @brief Gemeinsames 8-Zeilen-Canvas der Text-Apps (Uhr, Laufschrift, Wetter)
+ *
+ * Es läuft immer nur eine App, daher haben die Text-Apps ein Canvas für alle.
+ * Beim start() steht darin noch das Bild der vorherigen App: die App zeichnet
+ * es zuerst ganz neu, bevor sie es mit zeigeCanvas() auf das Board bringt.
+ */
+
+#ifndef TEXT_CANVAS_H
+#define TEXT_CANVAS_H
+
+#include <FastLED.h>
+#include <LEDMatrix.h>
+#include <PixelBoard.h>
+
+// Nur so breit wie das Board, mehr Spalten wären ohnehin unsichtbar
+#define CANVAS_BREITE   PixelBoard::BREITE
+#define CANVAS_HOEHE    8
+
+extern CRGB canvasLeds[CANVAS_BREITE * CANVAS_HOEHE];
+extern cLEDMatrix<CANVAS_BREITE, CANVAS_HOEHE, HORIZONTAL_MATRIX> canvas;
+
+// Canvas wird auf 16 Zeilen verdoppelt und eine Zeile nach unten geschoben
+inline constexpr auto canvasAbbildung = berechneCanvasAbbildung<CANVAS_BREITE, CANVAS_HOEHE>(
+  2,  // skalierungY
+  1   // zeilenVersatz
+);
+
+// Einmal in setup(), vor dem Init() der Text-Objekte
+void initCanvas();
+
+inline void loescheCanvas() {
+  fill_solid(canvasLeds, CANVAS_BREITE * CANVAS_HOEHE, CRGB::Black);
+}
+
+#endif
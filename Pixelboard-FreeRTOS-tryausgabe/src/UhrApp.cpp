@@ -0,0 +1,48 @@
+#include "UhrApp.h"
+#include <FontMatrise.h>
+#include <time.h>
+
+#define UPDATE_MS  50   // so oft wird die Zeit abgefragt
+
+void UhrApp::begin() {
+    uhrzeitText.SetFont(MatriseFontData);
+    uhrzeitText.Init(&canvas, canvas.Width(), canvas.Height(), 0, 0);
+    uhrzeitText.SetTextColrOptions(COLR_RGB | COLR_SINGLE, farbe.r, farbe.g, farbe.b);
+}
+
+void UhrApp::start(unsigned long jetzt) {
+    // Canvas und Board zeigen noch die vorherige App: beim nächsten Update
+    // alles neu zeichnen und als geändert melden
+    uhrzeitAngezeigt = false;
+    canvasDiff.invalidiere();
+    letztesUpdate = jetzt - UPDATE_MS;
+}
+
+void UhrApp::schritt(unsigned long jetzt) {
+    if (jetzt - letztesUpdate < UPDATE_MS) return;
+    letztesUpdate = jetzt;
+
+    // Ohne Warten abfragen, loop() darf nicht hängen bleiben
+    char neueUhrzeit[sizeof(uhrzeitString)];
+    struct tm timeinfo;
+    if (getLocalTime(&timeinfo, 0)) {
+        snprintf(neueUhrzeit, sizeof(neueUhrzeit), "%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
+    } else {
+        strcpy(neueUhrzeit, "--:--");
+    }
+
+    // "HH:MM" ändert sich nur einmal pro Minute - sonst gibt es nichts zu tun
+    if (uhrzeitAngezeigt && strcmp(neueUhrzeit, uhrzeitString) == 0) return;
+    strcpy(uhrzeitString, neueUhrzeit);
+    uhrzeitAngezeigt = true;
+
+    loescheCanvas();
+    uhrzeitText.SetText((unsigned char *)uhrzeitString, strlen(uhrzeitString));
+    uhrzeitText.UpdateText();
+
+    // Nur die Panels neu mappen, in denen sich etwas geändert hat
+    const DirtyRect dirty = canvasDiff.vergleiche(canvasLeds);
+    if (dirty.istLeer()) return;
+    if (!pixelBoard.zeigeCanvas(canvasAbbildung, canvasLeds, dirty.x0, dirty.y0, dirty.x1, dirty.y1)) return;
+    pixelBoard.show();
+}
@@ -0,0 +1,34 @@
+#ifndef UHR_APP_H
+#define UHR_APP_H
+
+#include <FastLED.h>
+#include <LEDMatrix.h>
+#include <LEDText.h>
+#include "AppManager.h"
+#include "CanvasDiff.h"
+#include "TextCanvas.h"
+
+// Uhrzeit (HH:MM) aus Pixelboard-Zeitausgabe. Die Zeit kommt per NTP, das
+// WLAN dafür baut main.cpp auf. Bis zur ersten Antwort steht dort "--:--".
+// Gesendet wird nur, wenn sich die Anzeige ändert, also einmal pro Minute.
+class UhrApp : public App {
+public:
+    explicit UhrApp(const CRGB &farbe) : farbe(farbe) {}
+
+    // Einmal in setup(), nach initCanvas()
+    void begin();
+
+    const char *name() const override { return "Uhr"; }
+    void start(unsigned long jetzt) override;
+    void schritt(unsigned long jetzt) override;
+
+private:
+    CRGB farbe;
+    cLEDText uhrzeitText;
+    CanvasDiff<CANVAS_BREITE, CANVAS_HOEHE> canvasDiff;
+    char uhrzeitString[6] = "";   // "HH:MM" + Nullterminator
+    bool uhrzeitAngezeigt = false;
+    unsigned long letztesUpdate = 0;
+};
+
+#endif
@@ -0,0 +1,110 @@
+#include "WetterApp.h"
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include <FontMatrise.h>
+
+#define ABRUF_MS        600000UL   // neue Daten alle 10 Minuten
+#define NEUVERSUCH_MS    30000UL   // nach einem Fehler früher nochmal
+#define SCROLL_MS           50     // Bildabstand der Laufschrift
+
+// Die Schrift kennt nur ASCII: Umlaute aus der UTF-8-Antwort umschreiben,
+// andere Zeichen außerhalb von ASCII auslassen
+static void nachAscii(const char *utf8, char *aus, size_t groesse) {
+    size_t n = 0;
+    for (const unsigned char *p = (const unsigned char *)utf8; *p && n + 2 < groesse; p++) {
+        if (*p < 0x80) {
+            aus[n++] = *p;
+            continue;
+        }
+        if (*p != 0xC3 || p[1] == 0) continue;
+        const char *ersatz = nullptr;
+        switch (*++p) {
+            case 0xA4: ersatz = "ae"; break;
+            case 0xB6: ersatz = "oe"; break;
+            case 0xBC: ersatz = "ue"; break;
+            case 0x84: ersatz = "Ae"; break;
+            case 0x96: ersatz = "Oe"; break;
+            case 0x9C: ersatz = "Ue"; break;
+            case 0x9F: ersatz = "ss"; break;
+        }
+        if (ersatz) {
+            aus[n++] = ersatz[0];
+            aus[n++] = ersatz[1];
+        }
+    }
+    aus[n] = '\0';
+}
+
+void WetterApp::begin() {
+    tickerText.SetFont(MatriseFontData);
+    tickerText.Init(&canvas, canvas.Width(), canvas.Height(), 0, 0);
+    tickerText.SetTextColour(farbe);
+    tickerText.SetScrollDirection(SCROLL_LEFT);
+    setzeAnzeige();
+}
+
+void WetterApp::start(unsigned long jetzt) {
+    // Erstes Bild sofort, es überdeckt das Canvas der vorherigen App ganz
+    letzterFrame = jetzt - SCROLL_MS;
+}
+
+void WetterApp::schritt(unsigned long jetzt) {
+    if ((!abgerufen || (long)(jetzt - naechsterAbruf) >= 0) && WiFi.status() == WL_CONNECTED) {
+        abgerufen = true;
+        const bool ok = holeWetter();
+        naechsterAbruf = millis() + (ok ? ABRUF_MS : NEUVERSUCH_MS);
+        if (ok) {
+            wetterGueltig = true;
+            setzeAnzeige();
+        }
+    }
+
+    if (jetzt - letzterFrame < SCROLL_MS) return;
+    letzterFrame = jetzt;
+
+    tickerText.UpdateText();
+    pixelBoard.zeigeCanvas(canvasAbbildung, canvasLeds);
+    pixelBoard.show();
+}
+
+bool WetterApp::holeWetter() {
+    HTTPClient http;
+    // HTTP/1.0: kein Chunked-Encoding, der Body kann direkt geparst werden
+    http.useHTTP10(true);
+    http.begin(url);
+
+    bool ok = false;
+    const int httpResponseCode = http.GET();
+    if (httpResponseCode == HTTP_CODE_OK) {
+        // Nur bei Erfolg werden die Felder in 'wetter' überschrieben
+        DeserializationError error = parseWeather(http.getStream(), wetter);
+        if (error) {
+            Serial.print(F("Wetter: JSON Parsing fehlgeschlagen: "));
+            Serial.println(error.c_str());
+        } else {
+            ok = true;
+        }
+    } else {
+        Serial.print(F("Wetter: Fehler beim Abrufen: "));
+        Serial.println(httpResponseCode);
+    }
+
+    http.end();
+    return ok;
+}
+
+void WetterApp::setzeAnzeige() {
+    if (wetterGueltig) {
+        char stadt[sizeof(wetter.stadt)];
+        char beschreibung[sizeof(wetter.beschreibung)];
+        nachAscii(wetter.stadt, stadt, sizeof(stadt));
+        nachAscii(wetter.beschreibung, beschreibung, sizeof(beschreibung));
+        snprintf(anzeige, sizeof(anzeige), "%s %.1fC %d%% %s   ",
+                 stadt, wetter.temp, wetter.luftfeuchte, beschreibung);
+    } else {
+        strlcpy(anzeige, "Warte auf Wetterdaten   ", sizeof(anzeige));
+    }
+    if (tickerText.SetText((const unsigned char *)anzeige, strlen(anzeige)) < 0) {
+        Serial.println(F("Wetter: Text zu lang fuer den Ticker-Streifen"));
+    }
+}
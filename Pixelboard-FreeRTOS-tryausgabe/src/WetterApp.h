@@ -0,0 +1,40 @@
+#ifndef WETTER_APP_H
+#define WETTER_APP_H
+
+#include <LEDTextStrip.h>
+#include "AppManager.h"
+#include "TextCanvas.h"
+#include "WeatherSnapshot.h"
+
+// Wetter aus Pixelboard-WetterAPI als Laufschrift: Stadt, Temperatur,
+// Luftfeuchtigkeit und Beschreibung. Abgerufen wird nur, während die App
+// geladen ist: beim ersten Laden, dann alle 10 Minuten (WLAN baut main.cpp auf).
+// Der HTTP-Abruf blockiert loop() für seine Dauer, höchstens bis zum
+// Timeout von HTTPClient.
+class WetterApp : public App {
+public:
+    WetterApp(const char *url, const CRGB &farbe) : url(url), farbe(farbe) {}
+
+    // Einmal in setup(), nach initCanvas()
+    void begin();
+
+    const char *name() const override { return "Wetter"; }
+    void start(unsigned long jetzt) override;
+    void schritt(unsigned long jetzt) override;
+
+private:
+    bool holeWetter();
+    void setzeAnzeige();
+
+    const char *url;
+    CRGB farbe;
+    cLEDTextStrip<1024> tickerText;
+    WeatherSnapshot wetter;
+    bool wetterGueltig = false;
+    bool abgerufen = false;       // mindestens ein Versuch seit dem Start
+    unsigned long naechsterAbruf = 0;
+    unsigned long letzterFrame = 0;
+    char anzeige[128];
+};
+
+#endif
@@ -1,103 +1,52 @@
 #include <Arduino.h>
-#include "EntprellterTaster.h"
+#include <WiFi.h>
+#include <PixelBoard.h>
+#include "Joystick.h"
+#include "AppManager.h"
+#include "TextCanvas.h"
+#include "SnakeApp.h"
+#include "UhrApp.h"
+#include "LaufschriftApp.h"
+#include "WetterApp.h"
 
 // ========== KONFIGURATION ==========
-const int BUTTON_PIN = 32;  // HIER DEN PIN EINTRAGEN!
-
-// ========== GLOBALE VARIABLEN ==========
-EntprellterTaster taster(BUTTON_PIN);
-
-// Task-Handles
-TaskHandle_t taskHauptHandle = NULL;
-TaskHandle_t taskAHandle = NULL;
-TaskHandle_t taskBHandle = NULL;
-TaskHandle_t taskCHandle = NULL;
-
-// Aktueller aktiver Task (0=A, 1=B, 2=C)
-volatile int aktiverTask = 0;
-
-// ========== TASK-FUNKTIONEN ==========
-
-// Task A: Gibt "a" im Sekundentakt aus
-void taskA(void *parameter) {
-  delay(5);  // Wichtig: Initiales Delay damit Task-Handle gesetzt wird
-  
-  Serial.println("Task A gestartet");
-  
-  while (true) {
-    Serial.println("a");
-    delay(1000);  // 1 Sekunde warten
-  }
-}
+// Joystick (ESP32 HTL Pixelboard), langer Tastendruck wechselt die App
+#define JOY_PIN_X  34   // Analog X
+#define JOY_PIN_Y  35   // Analog Y
+#define JOY_PIN_SW 32   // Button
 
-// Task B: Gibt "b" im Sekundentakt aus
-void taskB(void *parameter) {
-  delay(5);  // Wichtig: Initiales Delay damit Task-Handle gesetzt wird
-  
-  Serial.println("Task B gestartet");
-  
-  while (true) {
-    Serial.println("b");
-    delay(1000);  // 1 Sekunde warten
-  }
-}
+// LED-Pins und Panel-Mapping stecken in PixelBoard
+#define HELLIGKEIT 25
 
-// Task C: Gibt "c" im Sekundentakt aus
-void taskC(void *parameter) {
-  delay(5);  // Wichtig: Initiales Delay damit Task-Handle gesetzt wird
-  
-  Serial.println("Task C gestartet");
-  
-  while (true) {
-    Serial.println("c");
-    delay(1000);  // 1 Sekunde warten
-  }
-}
+// WLAN für Uhr (NTP) und Wetter - HIER EINTRAGEN!
+const char *ssid = "iPhone von Paul";
+const char *password = "rootroot";
 
-// Haupttask: Prüft auf langen Tastendruck und schaltet Tasks um
-void taskHaupt(void *parameter) {
-  delay(5);  // Wichtig: Initiales Delay damit Task-Handle gesetzt wird
-  
-  Serial.println("Haupttask gestartet - Warte auf langen Tastendruck...");
-  
-  while (true) {
-    // Taster aktualisieren
-    taster.aktualisiere();
-    
-    // Prüfen ob langer Tastendruck erkannt wurde
-    if (taster.wurdeLangeGedrueckt()) {
-      Serial.println("\n=== Langer Tastendruck erkannt! ===");
-      
-      // Aktuellen Task suspendieren
-      if (aktiverTask == 0 && taskAHandle != NULL) {
-        vTaskSuspend(taskAHandle);
-        Serial.println("Task A suspendiert");
-      } else if (aktiverTask == 1 && taskBHandle != NULL) {
-        vTaskSuspend(taskBHandle);
-        Serial.println("Task B suspendiert");
-      } else if (aktiverTask == 2 && taskCHandle != NULL) {
-        vTaskSuspend(taskCHandle);
-        Serial.println("Task C suspendiert");
-      }
-      
-      // Zum nächsten Task wechseln
-      aktiverTask = (aktiverTask + 1) % 3;
-      
-      // Neuen Task aktivieren
-      if (aktiverTask == 0 && taskAHandle != NULL) {
-        vTaskResume(taskAHandle);
-        Serial.println("Task A aktiviert\n");
-      } else if (aktiverTask == 1 && taskBHandle != NULL) {
-        vTaskResume(taskBHandle);
-        Serial.println("Task B aktiviert\n");
-      } else if (aktiverTask == 2 && taskCHandle != NULL) {
-        vTaskResume(taskCHandle);
-        Serial.println("Task C aktiviert\n");
-      }
-    }
-    
-    delay(10);  // Kurze Pause für Task-Wechsel
-  }
+// NTP Server und Zeitzone
+const char *ntpServer = "pool.ntp.org";
+const long gmtOffset_sec = 3600;              // +1 Stunde für MEZ
+const int daylightOffset_sec = 3600;          // +1 Stunde für Sommerzeit
+
+// OpenWeatherMap API
+const char *wetterUrl = "http://api.openweathermap.org/data/2.5/weather?q=Innsbruck,AT"
+                        "&appid=ec59e8958e52a071ca78979743962031&units=metric&lang=de";
+
+// Text der Laufschrift, Farbe und Modus (siehe LaufschriftApp.h) unten bei den Apps
+const char *laufschriftText = "LED Pixelboard Demo! ";
+
+// ========== APPS ==========
+Joystick joystick(JOY_PIN_X, JOY_PIN_Y, JOY_PIN_SW);
+
+SnakeApp snakeApp(joystick);
+UhrApp uhrApp(CRGB::White);
+LaufschriftApp laufschriftApp(laufschriftText, CRGB::Yellow, 5);
+WetterApp wetterApp(wetterUrl, CRGB::Cyan);
+
+AppManager<4> apps;
+
+static void meldeApp() {
+  Serial.print(apps.aktiveApp().name());
+  Serial.println(" geladen");
 }
 
 // ========== SETUP ==========
@@ -105,63 +54,46 @@ void setup() {
   // Serielle Kommunikation starten
   Serial.begin(115200);
   delay(1000);
-  Serial.println("\n\n=== FreeRTOS Task-Umschaltung ===");
-  Serial.println("Langer Tastendruck schaltet zwischen Tasks um");
+  Serial.println("\n\n=== Pixelboard Apps ===");
+  Serial.println("Langer Tastendruck schaltet zur nächsten App");
   Serial.println("=====================================\n");
-  
-  // Tasks erstellen
-  xTaskCreate(
-    taskHaupt,      // Task-Funktion
-    "Haupttask",    // Name
-    2048,           // Stack-Größe
-    NULL,           // Parameter
-    2,              // Priorität (höher als die anderen)
-    &taskHauptHandle // Handle
-  );
-  
-  xTaskCreate(
-    taskA,
-    "Task A",
-    2048,
-    NULL,
-    1,              // Niedrigere Priorität
-    &taskAHandle
-  );
-  
-  xTaskCreate(
-    taskB,
-    "Task B",
-    2048,
-    NULL,
-    1,
-    &taskBHandle
-  );
-  
-  xTaskCreate(
-    taskC,
-    "Task C",
-    2048,
-    NULL,
-    1,
-    &taskCHandle
-  );
-  
-  // Warten bis alle Tasks initialisiert sind
-  delay(100);
-  
-  // Task B und C initial suspendieren (Task A startet aktiv)
-  if (taskBHandle != NULL) {
-    vTaskSuspend(taskBHandle);
-  }
-  if (taskCHandle != NULL) {
-    vTaskSuspend(taskCHandle);
-  }
-  
-  Serial.println("Alle Tasks erstellt - Task A ist aktiv\n");
+
+  // Ein Framebuffer für alle Apps. Gamma vor begin(), für die Zwischenstufen
+  // der weichen Laufschrift; Doppelpuffer, damit sie nicht auf das Senden wartet.
+  pixelBoard.setzeGamma(2.2f);
+  pixelBoard.begin(HELLIGKEIT, true);
+  initCanvas();
+
+  // WLAN verbindet im Hintergrund, NTP synchronisiert, sobald es steht.
+  // Uhr und Wetter warten nicht darauf, bis dahin zeigen sie einen Platzhalter.
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(ssid, password);
+  configTime(gmtOffset_sec, daylightOffset_sec, ntpServer);
+
+  snakeApp.begin(esp_random());
+  uhrApp.begin();
+  laufschriftApp.begin();
+  wetterApp.begin();
+
+  // Alle Apps laufen nacheinander in loop(), keine eigenen Tasks und Stacks
+  apps.registriere(snakeApp);
+  apps.registriere(uhrApp);
+  apps.registriere(laufschriftApp);
+  apps.registriere(wetterApp);
+  apps.begin(millis());
+  meldeApp();
 }
 
 // ========== LOOP ==========
 void loop() {
-  // Loop bleibt leer, da FreeRTOS die Tasks verwaltet
-  delay(1000);
-}
\ No newline at end of file
+  joystick.aktualisiere();
+
+  // Langer Tastendruck: aktuelle App entladen, nächste laden
+  if (joystick.wurdeLangeGedrueckt()) {
+    apps.wechsle(millis());
+    meldeApp();
+  }
+
+  apps.schritt(millis());
+  delay(1);  // Joystick wird jede ms abgefragt, wie in snake_game
+}
@@ -1,6 +1,12 @@
 #ifndef LEDMatrix_h
 #define LEDMatrix_h
 
+// Self-contained, whatever was included before: CRGB comes from FastLED,
+// abs() for the tDraw* templates from stdlib.h
+#include <stdint.h>
+#include <stdlib.h>
+#include <FastLED.h>
+
 enum MatrixType_t { HORIZONTAL_MATRIX,
                     VERTICAL_MATRIX,
                     HORIZONTAL_ZIGZAG_MATRIX,
@@ -15,6 +21,7 @@ class cLEDMatrixBase
     MatrixType_t m_Type;
     struct CRGB *m_LED;
     struct CRGB m_OutOfBounds;
+    bool m_Linear;	// Plain HORIZONTAL_MATRIX, index is (y * m_Width) + x without calling mXY()
 
   public:
     cLEDMatrixBase();
@@ -22,7 +29,17 @@ class cLEDMatrixBase
     void SetLEDArray(struct CRGB *pLED);	// Only used with externally defined LED arrays
 
     struct CRGB *operator[](int n);
-    struct CRGB &operator()(int16_t x, int16_t y);
+    struct CRGB &operator()(int16_t x, int16_t y)
+    {
+      if ( (x >= 0) && (x < m_Width) && (y >= 0) && (y < m_Height))
+      {
+        if (m_Linear)
+          return(m_LED[(y * m_Width) + x]);
+        return(m_LED[mXY(x, y)]);
+      }
+      else
+        return(m_OutOfBounds);
+    }
     struct CRGB &operator()(int16_t i);
 
     int Size()  { return(m_Width * m_Height); }
@@ -43,8 +60,135 @@ class cLEDMatrixBase
     void DrawCircle(int16_t xc, int16_t yc, uint16_t r, CRGB Col);
     void DrawFilledRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, CRGB Col);
     void DrawFilledCircle(int16_t xc, int16_t yc, uint16_t r, CRGB Col);
+
+  protected:
+    // Drawing primitives written once against any matrix type M. The base class
+    // instantiates them with itself, cLEDMatrix with its statically mapped
+    // accessors so no pixel write goes through the virtual mXY().
+    template<class M> static void tDrawLine(M &m, int16_t x0, int16_t y0, int16_t x1, int16_t y1, CRGB Col);
+    template<class M> static void tDrawRectangle(M &m, int16_t x0, int16_t y0, int16_t x1, int16_t y1, CRGB Col);
+    template<class M> static void tDrawCircle(M &m, int16_t xc, int16_t yc, uint16_t r, CRGB Col);
+    template<class M> static void tDrawFilledRectangle(M &m, int16_t x0, int16_t y0, int16_t x1, int16_t y1, CRGB Col);
+    template<class M> static void tDrawFilledCircle(M &m, int16_t xc, int16_t yc, uint16_t r, CRGB Col);
 };
 
+// Unchecked view of one column of a HORIZONTAL_MATRIX, see cLEDMatrix::Column()
+class cLEDColumn
+{
+  public:
+    cLEDColumn(struct CRGB *pFirst, int16_t Stride, int16_t Height) : m_First(pFirst), m_Stride(Stride), m_Height(Height) {}
+    struct CRGB &operator[](int16_t y) { return(m_First[y * m_Stride]); }
+    int Height() { return(m_Height); }
+  private:
+    struct CRGB *m_First;
+    int16_t m_Stride, m_Height;
+};
+
+
+template<class M> void cLEDMatrixBase::tDrawLine(M &m, int16_t x0, int16_t y0, int16_t x1, int16_t y1, CRGB Col)
+{
+  int16_t dx = x1 - x0;
+  int16_t dy = y1 - y0;
+  if (abs(dx) >= abs(dy))
+  {
+    int32_t y = ((int32_t)y0 << 16) + 32768;
+    if (dx == 0)
+    {
+      m(x0, (y >> 16)) = Col;
+    }
+    else
+    {
+      int32_t f = ((int32_t)dy << 16) / (int32_t)abs(dx);
+      if (dx >= 0)
+      {
+        for (; x0<=x1; ++x0,y+=f)
+          m(x0, (y >> 16)) = Col;
+      }
+      else
+      {
+        for (; x0>=x1; --x0,y+=f)
+          m(x0, (y >> 16)) = Col;
+      }
+    }
+  }
+  else
+  {
+    int32_t f = ((int32_t)dx << 16) / (int32_t)abs(dy);
+    int32_t x = ((int32_t)x0 << 16) + 32768;
+    if (dy >= 0)
+    {
+      for (; y0<=y1; ++y0,x+=f)
+        m((x >> 16), y0) = Col;
+    }
+    else
+    {
+      for (; y0>=y1; --y0,x+=f)
+        m((x >> 16), y0) = Col;
+    }
+  }
+}
+
+
+template<class M> void cLEDMatrixBase::tDrawRectangle(M &m, int16_t x0, int16_t y0, int16_t x1, int16_t y1, CRGB Col)
+{
+  m.DrawLine(x0, y0, x0, y1, Col);
+  m.DrawLine(x0, y1, x1, y1, Col);
+  m.DrawLine(x1, y1, x1, y0, Col);
+  m.DrawLine(x1, y0, x0, y0, Col);
+}
+
+
+template<class M> void cLEDMatrixBase::tDrawCircle(M &m, int16_t xc, int16_t yc, uint16_t r, CRGB Col)
+{
+  int16_t x = -r;
+  int16_t y = 0;
+  int16_t e = 2 - (2 * r);
+  do
+  {
+    m(xc + x, yc - y) = Col;
+    m(xc - x, yc + y) = Col;
+    m(xc + y, yc + x) = Col;
+    m(xc - y, yc - x) = Col;
+    int16_t _e = e;
+    if (_e <= y)
+      e += (++y * 2) + 1;
+    if ((_e > x) || (e > y))
+      e += (++x * 2) + 1;
+  }
+  while (x < 0);
+}
+
+
+template<class M> void cLEDMatrixBase::tDrawFilledRectangle(M &m, int16_t x0, int16_t y0, int16_t x1, int16_t y1, CRGB Col)
+{
+  int16_t y = (y0 < y1) ? y0 : y1;
+  for (int16_t c=abs(y1-y0); c>=0; --c,++y)
+    m.DrawLine(x0, y, x1, y, Col);
+}
+
+
+template<class M> void cLEDMatrixBase::tDrawFilledCircle(M &m, int16_t xc, int16_t yc, uint16_t r, CRGB Col)
+{
+  int16_t x = r;
+  int16_t y = 0;
+  int16_t e = 1 - x;
+  while (x >= y)
+  {
+    m.DrawLine(xc + x, yc + y, xc - x, yc + y, Col);
+    m.DrawLine(xc + y, yc + x, xc - y, yc + x, Col);
+    m.DrawLine(xc - x, yc - y, xc + x, yc - y, Col);
+    m.DrawLine(xc - y, yc - x, xc + y, yc - x, Col);
+    ++y;
+    if (e >= 0)
+    {
+      --x;
+      e += 2 * ((y - x) + 1);
+    }
+    else
+      e += (2 * y) + 1;
+  }
+}
+
 template<int16_t tWidth, int16_t tHeight, MatrixType_t tMType, int16_t tXMult = 0, int16_t tYMult = 0> class cLEDMatrix : public cLEDMatrixBase
 {
   private:
@@ -58,6 +202,7 @@ template<int16_t tWidth, int16_t tHeight, MatrixType_t tMType, int16_t tXMult =
       m_Width = m_absWidth;
       m_Height = m_absHeight;
       m_Type = tMType;
+      m_Linear = (tMType == HORIZONTAL_MATRIX) && (tWidth > 0) && (tHeight > 0) && (tXMult == 0) && (tYMult == 0);
       if ((tXMult == 0) && (tYMult == 0))
         m_LED = p_LED;
       else
@@ -68,6 +213,12 @@ template<int16_t tWidth, int16_t tHeight, MatrixType_t tMType, int16_t tXMult =
       m_LED = pLED;
     }
     virtual uint16_t mXY(uint16_t x, uint16_t y)
+    {
+      return(XY(x, y));
+    }
+
+    // Statically dispatched mapping, every branch folds away for the given template parameters
+    static uint16_t XY(uint16_t x, uint16_t y)
     {
       if (tWidth < 0)
         x = (m_absWidth - 1) - x;
@@ -123,6 +274,37 @@ template<int16_t tWidth, int16_t tHeight, MatrixType_t tMType, int16_t tXMult =
       }
     }
 
+    // Non virtual accessors, hide the cLEDMatrixBase versions for callers that know the concrete type
+    struct CRGB &operator()(int16_t x, int16_t y)
+    {
+      if ( (x >= 0) && (x < m_absWidth) && (y >= 0) && (y < m_absHeight))
+        return(m_LED[XY(x, y)]);
+      else
+        return(m_OutOfBounds);
+    }
+    struct CRGB &operator()(int16_t i)
+    {
+      return(cLEDMatrixBase::operator()(i));
+    }
+
+    // Row and column spans, only for plain HORIZONTAL_MATRIX layouts where a row is contiguous
+    struct CRGB *Row(int16_t y)
+    {
+      static_assert((tMType == HORIZONTAL_MATRIX) && (tWidth > 0) && (tXMult == 0) && (tYMult == 0), "Row() needs a plain HORIZONTAL_MATRIX");
+      return(&m_LED[XY(0, y)]);
+    }
+    cLEDColumn Column(int16_t x)
+    {
+      static_assert((tMType == HORIZONTAL_MATRIX) && (tWidth > 0) && (tXMult == 0) && (tYMult == 0), "Column() needs a plain HORIZONTAL_MATRIX");
+      return(cLEDColumn(&m_LED[XY(x, 0)], (tHeight > 0) ? m_absWidth : -m_absWidth, m_absHeight));
+    }
+
+    void DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, CRGB Col) { tDrawLine(*this, x0, y0, x1, y1, Col); }
+    void DrawRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, CRGB Col) { tDrawRectangle(*this, x0, y0, x1, y1, Col); }
+    void DrawCircle(int16_t xc, int16_t yc, uint16_t r, CRGB Col) { tDrawCircle(*this, xc, yc, r, Col); }
+    void DrawFilledRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, CRGB Col) { tDrawFilledRectangle(*this, x0, y0, x1, y1, Col); }
+    void DrawFilledCircle(int16_t xc, int16_t yc, uint16_t r, CRGB Col) { tDrawFilledCircle(*this, xc, yc, r, Col); }
+
     void ShiftLeft(void)
     {
       if ((tXMult == 0) && (tYMult == 0))
@@ -0,0 +1,273 @@
+#ifndef LEDTextStrip_h
+#define LEDTextStrip_h
+
+/*
+cLEDTextStrip - pre-rasterised horizontal ticker for cLEDText fonts
+
+SetText() expands every character once into a column cache and lays the
+whole text out as one bit strip per font row. Scrolling is then only an
+offset into those strips: each frame extracts 32 columns at a time with a
+shift and writes them to the matrix, so the cost per frame depends on the
+display width and not on the text length.
+
+DrawFract() places the text at a fractional column position and blends
+each pixel from its two neighbouring strip columns, so motion can follow
+elapsed time instead of whole-pixel steps.
+
+Supports plain text (no inline EFFECT_ codes), a single colour, background
+erase and SCROLL_LEFT / SCROLL_RIGHT. The text loops seamlessly, the end
+of the text is followed directly by its start again.
+*/
+
+#include <FastLED.h>
+#include <LEDMatrix.h>
+#include <LEDText.h>
+
+#define  TEXTSTRIP_MAX_ROWS     16
+#define  TEXTSTRIP_MAX_GLYPHS   96
+#define  TEXTSTRIP_MAX_GLYPH_W  8
+
+template<uint16_t tMaxColumns> class cLEDTextStrip
+{
+  public:
+    void SetFont(const uint8_t *FontData)
+    {
+      m_FontHeight = FontData[1];
+      m_FontBase = FontData[2];
+      m_FontUpper = FontData[3];
+      m_FontData = &FontData[4];
+      m_FProp = ((FontData[0] & FONT_PROPORTIONAL) == FONT_PROPORTIONAL);
+      m_FontWidth = FontData[0] & 0x7f;
+      m_FWBytes = (m_FontWidth + 7) / 8;
+      m_FCBytes = (m_FWBytes * m_FontHeight) + (m_FProp ? 1 : 0);
+      if (m_FontHeight > TEXTSTRIP_MAX_ROWS)
+        m_FontHeight = TEXTSTRIP_MAX_ROWS;
+      memset(m_GlyphValid, 0, sizeof(m_GlyphValid));
+    }
+
+    void Init(cLEDMatrixBase *Matrix, uint16_t Width, uint16_t Height, int16_t OriginX = 0, int16_t OriginY = 0)
+    {
+      m_Matrix = Matrix;
+      m_XMin = OriginX;
+      m_YMin = OriginY;
+      m_Width = Width;
+      m_Height = Height;
+      m_Colour = CRGB(255, 255, 255);
+      m_ScrollRight = false;
+      m_TextCols = m_Offset = 0;
+    }
+
+    void SetTextColour(const CRGB &Colour) { m_Colour = Colour; }
+
+    void SetScrollDirection(uint16_t Options) { m_ScrollRight = ((Options & SCROLL_RIGHT) == SCROLL_RIGHT); }
+
+    // Lays the text out into the row strips. Returns the number of text
+    // columns or -1 if text plus one wrapped screen width does not fit.
+    int SetText(const unsigned char *Txt, uint16_t TxtSize)
+    {
+      uint16_t cols = 0;
+      for (uint16_t i=0; i<TxtSize; i++)
+        cols += GlyphWidth(Txt[i]) + 1;
+      if ((cols == 0) || ((uint32_t)cols + m_Width + 1 > tMaxColumns))
+        return(-1);
+
+      memset(m_Rows, 0, sizeof(m_Rows));
+      uint16_t x = 0;
+      for (uint16_t i=0; i<TxtSize; i++)
+      {
+        const uint16_t *g = Glyph(Txt[i]);
+        uint8_t fw = GlyphWidth(Txt[i]);
+        for (uint8_t c=0; c<fw; c++, x++)
+          SetColumn(x, (c < TEXTSTRIP_MAX_GLYPH_W) ? g[c] : 0);
+        x++;  // blank gap column
+      }
+      // Repeat the start behind the end so a window never has to wrap
+      for (uint16_t c=0; c<=m_Width; c++)
+        SetColumn(cols + c, GetColumn(c % cols));
+      m_TextCols = cols;
+      m_Offset = 0;
+      return(cols);
+    }
+
+    uint16_t TextColumns() { return(m_TextCols); }
+    void SetOffset(uint16_t Offset) { m_Offset = (m_TextCols > 0) ? (Offset % m_TextCols) : 0; }
+
+    // Advances one column and draws. Returns 1 each time the text has
+    // passed completely, otherwise 0 (-1 without text).
+    int UpdateText()
+    {
+      if (m_TextCols == 0)
+        return(-1);
+      int rc = 0;
+      if (m_ScrollRight)
+        m_Offset = (m_Offset == 0) ? m_TextCols - 1 : m_Offset - 1;
+      else if (++m_Offset >= m_TextCols)
+        m_Offset = 0;
+      if (m_Offset == 0)
+        rc = 1;
+      Draw();
+      return(rc);
+    }
+
+    // Draws the window at the current offset, 32 columns per strip read
+    void Draw()
+    {
+      const CRGB black(0, 0, 0);
+      for (int16_t y=m_YMin; y<(m_YMin + m_Height); y++)
+      {
+        if ((y < 0) || (y >= (*m_Matrix).Height()))
+          continue;
+        // Same placement as cLEDText with CHAR_UP: font row 0 one line
+        // below the top edge, everything else is background
+        int16_t r = (m_YMin + m_Height - 2) - y;
+        bool glyphRow = (r >= 0) && (r < m_FontHeight);
+        for (uint16_t x0=0; x0<m_Width; x0+=32)
+        {
+          uint32_t bits = glyphRow ? Window(r, m_Offset + x0) : 0;
+          uint8_t n = ((m_Width - x0) < 32) ? (m_Width - x0) : 32;
+          int16_t x = m_XMin + x0;
+          for (uint8_t b=0; b<n; b++, x++, bits>>=1)
+            (*m_Matrix)(x, y) = (bits & 1) ? m_Colour : black;
+        }
+      }
+    }
+
+    // Draws the text scrolled by Distance columns in 1/256 steps. Each
+    // pixel is blended from the two strip columns it lies between.
+    // The strip is 1 bit per pixel and moves only horizontally, so every
+    // pixel is one of four cases (off, left, right, both) and the blend
+    // is a select between colours computed once per frame. Splatting
+    // with fl::Tile2x2_u8 would also blend vertically and need its own
+    // raster pass into an XYMap, while this draws straight into the
+    // cLEDMatrix 32 columns at a time.
+    void DrawFract(uint32_t Distance)
+    {
+      if (m_TextCols == 0)
+        return;
+      uint32_t total = (uint32_t)m_TextCols << 8;
+      uint32_t pos = Distance % total;
+      if (m_ScrollRight && (pos != 0))
+        pos = total - pos;
+      uint16_t offset = pos >> 8;
+      uint8_t f = pos & 0xff;
+      if (f == 0)
+      {
+        m_Offset = offset;
+        Draw();
+        return;
+      }
+
+      const CRGB black(0, 0, 0);
+      CRGB colA = m_Colour, colB = m_Colour;
+      colA.nscale8(255 - f);  // only the left column is set
+      colB.nscale8(f);        // only the right column is set
+      for (int16_t y=m_YMin; y<(m_YMin + m_Height); y++)
+      {
+        if ((y < 0) || (y >= (*m_Matrix).Height()))
+          continue;
+        int16_t r = (m_YMin + m_Height - 2) - y;
+        bool glyphRow = (r >= 0) && (r < m_FontHeight);
+        for (uint16_t x0=0; x0<m_Width; x0+=32)
+        {
+          uint32_t bitsA = glyphRow ? Window(r, offset + x0) : 0;
+          uint32_t bitsB = glyphRow ? Window(r, offset + x0 + 1) : 0;
+          uint8_t n = ((m_Width - x0) < 32) ? (m_Width - x0) : 32;
+          int16_t x = m_XMin + x0;
+          for (uint8_t b=0; b<n; b++, x++, bitsA>>=1, bitsB>>=1)
+          {
+            switch ((bitsA & 1) | ((bitsB & 1) << 1))
+            {
+              case 0: (*m_Matrix)(x, y) = black; break;
+              case 1: (*m_Matrix)(x, y) = colA; break;
+              case 2: (*m_Matrix)(x, y) = colB; break;
+              default: (*m_Matrix)(x, y) = m_Colour; break;
+            }
+          }
+        }
+      }
+    }
+
+  private:
+    static const uint16_t WORDS = (tMaxColumns + 31) / 32 + 1;
+
+    uint8_t GlyphWidth(unsigned char ch)
+    {
+      if ((ch < m_FontBase) || (ch > m_FontUpper))
+        return(0);
+      if (m_FProp)
+        return(m_FontData[(ch - m_FontBase) * m_FCBytes]);
+      return(m_FontWidth);
+    }
+
+    // Glyph as column bitmasks (bit r = font row r), decoded on first use
+    const uint16_t *Glyph(unsigned char ch)
+    {
+      static const uint16_t empty[TEXTSTRIP_MAX_GLYPH_W] = { 0 };
+      uint8_t gi = ch - m_FontBase;
+      if ((ch < m_FontBase) || (ch > m_FontUpper) || (gi >= TEXTSTRIP_MAX_GLYPHS))
+        return(empty);
+      if (!(m_GlyphValid[gi >> 3] & (1 << (gi & 7))))
+      {
+        uint16_t fdo = gi * m_FCBytes + (m_FProp ? 1 : 0);
+        uint8_t fw = GlyphWidth(ch);
+        for (uint8_t c=0; (c<fw) && (c<TEXTSTRIP_MAX_GLYPH_W); c++)
+        {
+          uint16_t mask = 0;
+          for (uint8_t r=0; (r<m_FontHeight) && (r<TEXTSTRIP_MAX_ROWS); r++)
+          {
+            if (m_FontData[fdo + (r * m_FWBytes) + (c / 8)] & (0x80 >> (c % 8)))
+              mask |= (1 << r);
+          }
+          m_GlyphCols[gi][c] = mask;
+        }
+        m_GlyphValid[gi >> 3] |= (1 << (gi & 7));
+      }
+      return(m_GlyphCols[gi]);
+    }
+
+    void SetColumn(uint16_t x, uint16_t mask)
+    {
+      for (uint8_t r=0; r<m_FontHeight; r++)
+      {
+        if (mask & (1 << r))
+          m_Rows[r][x >> 5] |= (1UL << (x & 31));
+      }
+    }
+
+    uint16_t GetColumn(uint16_t x)
+    {
+      uint16_t mask = 0;
+      for (uint8_t r=0; r<m_FontHeight; r++)
+      {
+        if (m_Rows[r][x >> 5] & (1UL << (x & 31)))
+          mask |= (1 << r);
+      }
+      return(mask);
+    }
+
+    // 32 strip columns starting at column x, bit 0 = column x
+    uint32_t Window(uint8_t r, uint16_t x)
+    {
+      uint16_t w = x >> 5;
+      uint8_t s = x & 31;
+      uint32_t bits = m_Rows[r][w] >> s;
+      if (s != 0)
+        bits |= m_Rows[r][w + 1] << (32 - s);
+      return(bits);
+    }
+
+    cLEDMatrixBase *m_Matrix;
+    const uint8_t *m_FontData;
+    uint8_t m_FontWidth, m_FontHeight, m_FontBase, m_FontUpper, m_FWBytes;
+    uint16_t m_FCBytes;
+    bool m_FProp, m_ScrollRight;
+    int16_t m_XMin, m_YMin;
+    uint16_t m_Width, m_Height;
+    CRGB m_Colour;
+    uint16_t m_TextCols, m_Offset;
+    uint16_t m_GlyphCols[TEXTSTRIP_MAX_GLYPHS][TEXTSTRIP_MAX_GLYPH_W];
+    uint8_t m_GlyphValid[(TEXTSTRIP_MAX_GLYPHS + 7) / 8];
+    uint32_t m_Rows[TEXTSTRIP_MAX_ROWS][WORDS];
+};
+
+#endif
@@ -6,7 +6,9 @@
 #include <FastLED.h>
 #include <LEDMatrix.h>
 #include <LEDText.h>
+#include <LEDTextStrip.h>
 #include <FontMatrise.h>
+#include <PixelBoard.h>
 
 // =============================================================================
 // --- BENUTZER EINSTELLUNGEN (HIER ÄNDERN) ------------------------------------
@@ -24,67 +26,57 @@ CRGB textFarbe = CRGB::Yellow;
 // 2 = Laufschrift nach RECHTS
 // 3 = Laufschrift nach OBEN
 // 4 = Laufschrift nach UNTEN
+// 5 = Weiche Laufschrift nach LINKS  (zeitbasiert, Zwischenpositionen)
+// 6 = Weiche Laufschrift nach RECHTS
 int textModus = 0;
 
 // 4. Geschwindigkeit (Kleiner = Schneller, Größer = Langsamer)
 // Empfehlung: 30 bis 100
 int scrollGeschwindigkeit = 10;
 
+// 5. Geschwindigkeit für Modus 5/6 in Pixel pro Sekunde
+int pixelProSekunde = 20;
+
 // =============================================================================
 // --- Hardware-Konfiguration (NICHT ÄNDERN) -----------------------------------
 // =============================================================================
 
-#define pinTop         25   // alter "Top"-Pin, jetzt physisch unten
-#define pinBottom      26   // alter "Bottom"-Pin, jetzt physisch oben
-
-#define panelWidth     32
-#define panelHeight     8
-
-#define ledsPerPanel   (panelWidth * panelHeight)
+// LED-Pins und Panel-Mapping stecken in PixelBoard
 #define brightness     25
-#define colorOrder     GRB
-#define chipset        WS2812
+#define weichFrameMs    8   // Bildabstand in Modus 5/6 (~125 FPS)
 
 // --- Virtuelles Canvas -------------------------------------------------------
-#define canvasWidth8   64
+// Nur so breit wie das Board, mehr Spalten wären ohnehin unsichtbar
+#define canvasWidth8   PixelBoard::BREITE
 #define canvasHeight8   8
 
-#define canvasWidth16  64
-#define canvasHeight16 16
-
 CRGB canvas8Leds[canvasWidth8 * canvasHeight8];
-CRGB canvas16Leds[canvasWidth16 * canvasHeight16];
 
 cLEDMatrix<canvasWidth8, canvasHeight8, HORIZONTAL_MATRIX> canvas8;
-cLEDMatrix<canvasWidth16, canvasHeight16, HORIZONTAL_MATRIX> canvas16;
-
-// --- Physische Panels --------------------------------------------------------
-CRGB ledsTop[ledsPerPanel];
-CRGB ledsBottom[ledsPerPanel];
-
-cLEDMatrix<panelWidth, panelHeight, VERTICAL_ZIGZAG_MATRIX> panelTop;    // logisches TOP
-cLEDMatrix<panelWidth, panelHeight, VERTICAL_ZIGZAG_MATRIX> panelBottom; // logisches BOTTOM
 
-// --- Laufschrift Objekt ------------------------------------------------------
+// --- Canvas -> Board ---------------------------------------------------------
+// Canvas8 wird auf 16 Zeilen verdoppelt und eine Zeile nach unten geschoben.
+static constexpr auto canvasAbbildung = berechneCanvasAbbildung<canvasWidth8, canvasHeight8>(
+  2,  // skalierungY
+  1   // zeilenVersatz
+);
+
+// --- Laufschrift Objekte -----------------------------------------------------
+// Links/Rechts und statisch: vorgerasterter Streifen, Aufwand unabhängig von
+// der Textlänge. Oben/Unten: klassisches cLEDText.
+cLEDTextStrip<1024> tickerText;
 cLEDText scrollingText;
 static uint32_t lastFrameMs = 0;
+static uint32_t weichStartMs = 0;
 
 // --- Prototypen --------------------------------------------------------------
 static void initAnzeige();
 static void updateAnzeige();
-static void scaleVertTo16();
-static void verschiebeCanvas16EineZeileNachUnten();
-static void blitPanelsFromCanvas16();
-static void mirrorPanelHorizontal(cLEDMatrix<panelWidth, panelHeight, VERTICAL_ZIGZAG_MATRIX> &panel);
-static void rotatePanel180(cLEDMatrix<panelWidth, panelHeight, VERTICAL_ZIGZAG_MATRIX> &panel);
 
-// kleine Hilfsfunktionen zum Löschen der Canvas-Arrays
+// kleine Hilfsfunktion zum Löschen des Canvas-Arrays
 static inline void clearCanvas8() {
   fill_solid(canvas8Leds, canvasWidth8 * canvasHeight8, CRGB::Black);
 }
-static inline void clearCanvas16() {
-  fill_solid(canvas16Leds, canvasWidth16 * canvasHeight16, CRGB::Black);
-}
 
 // --- Setup -------------------------------------------------------------------
 void setup() {
@@ -106,19 +98,14 @@ void loop() {
 // --- Implementierung ---------------------------------------------------------
 
 static void initAnzeige() {
-  // FastLED Setup
-  FastLED.addLeds<chipset, pinTop,    colorOrder>(ledsTop,    ledsPerPanel);
-  FastLED.addLeds<chipset, pinBottom, colorOrder>(ledsBottom, ledsPerPanel);
-  FastLED.setBrightness(brightness);
-  FastLED.clear(true);
-
-  // Mapping Panel Objekte auf LED Arrays
-  panelTop.SetLEDArray(ledsBottom);   // Pin 26, physisch oben
-  panelBottom.SetLEDArray(ledsTop);   // Pin 25, physisch unten
+  // Beide Streifen, Helligkeit, alles löschen. Doppelpuffer, damit das weiche
+  // Scrollen den nächsten Frame rechnet, während der letzte gesendet wird.
+  // Gamma 2.2, damit die Zwischenstufen beim weichen Scrollen gleichmäßig wirken
+  pixelBoard.setzeGamma(2.2f);
+  pixelBoard.begin(brightness, true);
 
   // Mapping Canvas
   canvas8.SetLEDArray(canvas8Leds);
-  canvas16.SetLEDArray(canvas16Leds);
 
   // Text Initialisierung
   scrollingText.SetFont(MatriseFontData);
@@ -130,12 +117,23 @@ static void initAnzeige() {
   // Text setzen
   scrollingText.SetText((unsigned char*)textInhalt, strlen(textInhalt));
 
+  // Ticker: Glyphen einmal rastern und den ganzen Text als Streifen ablegen
+  tickerText.SetFont(MatriseFontData);
+  tickerText.Init(&canvas8, canvas8.Width(), canvas8.Height(), 0, 0);
+  tickerText.SetTextColour(textFarbe);
+  if (tickerText.SetText((const unsigned char*)textInhalt, strlen(textInhalt)) < 0) {
+    Serial.println(F("Text zu lang fuer den Ticker-Streifen"));
+  }
+
+  weichStartMs = millis();
+
   // Richtung initial setzen basierend auf Modus
   if (textModus == 0) {
       // Statisch -> Wir setzen den Modus auf Links (wird aber nicht kontinuierlich geupdated)
-      scrollingText.SetScrollDirection(SCROLL_LEFT);
-  } else if (textModus == 1) scrollingText.SetScrollDirection(SCROLL_LEFT);
-  else if (textModus == 2) scrollingText.SetScrollDirection(SCROLL_RIGHT);
+      tickerText.SetScrollDirection(SCROLL_LEFT);
+  } else if (textModus == 1) tickerText.SetScrollDirection(SCROLL_LEFT);
+  else if (textModus == 2 || textModus == 6) tickerText.SetScrollDirection(SCROLL_RIGHT);
+  else if (textModus == 5) tickerText.SetScrollDirection(SCROLL_LEFT);
   else if (textModus == 3) scrollingText.SetScrollDirection(SCROLL_UP);
   else if (textModus == 4) scrollingText.SetScrollDirection(SCROLL_DOWN);
 }
@@ -144,7 +142,10 @@ static void updateAnzeige() {
   const uint32_t now = millis();
 
   // Geschwindigkeitskontrolle
-  if (now - lastFrameMs < (uint32_t)scrollGeschwindigkeit) return;
+  // Modus 5/6 zeichnet im festen Bildtakt, die Textposition folgt der Zeit
+  const bool weich = (textModus == 5 || textModus == 6);
+  const uint32_t bildAbstand = weich ? weichFrameMs : (uint32_t)scrollGeschwindigkeit;
+  if (now - lastFrameMs < bildAbstand) return;
   lastFrameMs = now;
 
   // --- SCHRITT 1: Text Update (Virtuelle 8px Ebene) ---
@@ -156,8 +157,8 @@ static void updateAnzeige() {
         // Canvas zurücksetzen
         clearCanvas8();
 
-        // Text (erneut) setzen und einmal zeichnen
-        scrollingText.SetText((unsigned char*)textInhalt, strlen(textInhalt));
+        // Streifen an den Textanfang setzen und einmal zeichnen
+        tickerText.SetOffset(0);
 
         // Falls du ihn zentriert haben willst, kannst du die Start-Position anpassen.
         // Hier ein einfacher Versuch, grob basierend auf 6px character width:
@@ -169,16 +170,30 @@ static void updateAnzeige() {
         // scroller hat eventuell keine direkte SetTextPos API -> wir belassen es bei Standard
         // und verlassen uns auf zentrierte Füllung durch Startpunkt-Berechnung, falls benötigt.
 
-        // UpdateText einmal aufrufen um zu zeichnen
-        scrollingText.UpdateText();
+        // Draw einmal aufrufen um zu zeichnen
+        tickerText.Draw();
         warVorherScrollend = false;
     }
   }
+  else if (textModus == 1 || textModus == 2) {
+    // LAUFSCHRIFT LINKS/RECHTS: nur Versatz im Streifen weiterschieben,
+    // am Textende geht es nahtlos mit dem Anfang weiter
+    tickerText.SetScrollDirection(textModus == 1 ? SCROLL_LEFT : SCROLL_RIGHT);
+    tickerText.SetTextColour(textFarbe);
+    tickerText.UpdateText();
+  }
+  else if (weich) {
+    // WEICHE LAUFSCHRIFT: Strecke seit dem Start in 1/256 Pixel, der Text
+    // steht dazwischen und wird aus zwei Nachbarspalten überblendet
+    tickerText.SetScrollDirection(textModus == 5 ? SCROLL_LEFT : SCROLL_RIGHT);
+    tickerText.SetTextColour(textFarbe);
+    const uint64_t strecke = (uint64_t)(now - weichStartMs) * pixelProSekunde * 256 / 1000;
+    const uint64_t laenge = (uint64_t)tickerText.TextColumns() << 8;
+    if (laenge > 0) tickerText.DrawFract(strecke % laenge);
+  }
   else {
-    // BEWEGUNG (Modus 1-4)
+    // BEWEGUNG (Modus 3-4)
     // Richtung sicherstellen (falls Variable live geändert wurde)
-    if (textModus == 1) scrollingText.SetScrollDirection(SCROLL_LEFT);
-    if (textModus == 2) scrollingText.SetScrollDirection(SCROLL_RIGHT);
     if (textModus == 3) scrollingText.SetScrollDirection(SCROLL_UP);
     if (textModus == 4) scrollingText.SetScrollDirection(SCROLL_DOWN);
 
@@ -193,94 +208,9 @@ static void updateAnzeige() {
     }
   }
 
-  // --- SCHRITT 2: Skalieren auf 16px Höhe ---
-  scaleVertTo16();
-
-  // --- SCHRITT 3: Verschieben (Hardware-Korrektur) ---
-  verschiebeCanvas16EineZeileNachUnten();
-
-  // --- SCHRITT 4: Auf Panels mappen & Hardware-Fixes ---
-  blitPanelsFromCanvas16();
+  // --- SCHRITT 2: Skalieren, Verschieben & auf Panels mappen (ein Durchlauf) ---
+  pixelBoard.zeigeCanvas(canvasAbbildung, canvas8Leds);
 
   // Anzeigen
-  FastLED.show();
-}
-
-// -----------------------------------------------------------------------------
-// --- UNVERÄNDERTE HARDWARE HELFER FUNKTIONEN ---------------------------------
-// -----------------------------------------------------------------------------
-
-static void scaleVertTo16() {
-  for (uint8_t y8 = 0; y8 < canvasHeight8; y8++) {
-    const uint8_t y16a = 2 * y8;
-    const uint8_t y16b = y16a + 1;
-    for (uint8_t x = 0; x < canvasWidth8; x++) {
-      const CRGB c = canvas8(x, y8);
-      canvas16(x, y16a) = c;
-      canvas16(x, y16b) = c;
-    }
-  }
-}
-
-static void verschiebeCanvas16EineZeileNachUnten() {
-  for (int y = canvasHeight16 - 1; y > 0; y--) {
-    for (uint8_t x = 0; x < canvasWidth16; x++) {
-      canvas16(x, y) = canvas16(x, y - 1);
-    }
-  }
-  for (uint8_t x = 0; x < canvasWidth16; x++) {
-    canvas16(x, 0) = CRGB::Black;
-  }
-}
-
-static void blitPanelsFromCanvas16() {
-  // Oberes physisches Panel (Pin 26) bekommt logisches unten
-  for (uint8_t y = 0; y < panelHeight; y++) {
-    const uint8_t ySrc = y + panelHeight; // 8..15
-    for (uint8_t x = 0; x < panelWidth; x++) {
-      panelTop(x, y) = canvas16(x, ySrc);
-    }
-  }
-
-  // Unteres physisches Panel (Pin 25) bekommt logisches oben
-  for (uint8_t y = 0; y < panelHeight; y++) {
-    const uint8_t ySrc = y; // 0..7
-    for (uint8_t x = 0; x < panelWidth; x++) {
-      panelBottom(x, y) = canvas16(x, ySrc);
-    }
-  }
-
-  // Spiegelung an der y-Achse für beide Panels
-  mirrorPanelHorizontal(panelTop);
-  mirrorPanelHorizontal(panelBottom);
-
-  // Kopfüber montiertes Panel (früher unten, jetzt oben) drehen
-  rotatePanel180(panelTop);
-
-  // Panels auf ihre LED-Arrays schreiben (falls benötigt von Library;
-  // Viele cLEDMatrix Implementierungen schreiben automatisch in das Array,
-  // da wir SetLEDArray() verwendet haben. FastLED.show() wird am Ende gerufen.)
-}
-
-static void mirrorPanelHorizontal(cLEDMatrix<panelWidth, panelHeight, VERTICAL_ZIGZAG_MATRIX> &panel) {
-  for (uint8_t y = 0; y < panelHeight; y++) {
-    for (uint8_t x = 0; x < panelWidth / 2; x++) {
-      const uint8_t xo = panelWidth - 1 - x;
-      CRGB tmp      = panel(x, y);
-      panel(x, y)   = panel(xo, y);
-      panel(xo, y)  = tmp;
-    }
-  }
-}
-
-static void rotatePanel180(cLEDMatrix<panelWidth, panelHeight, VERTICAL_ZIGZAG_MATRIX> &panel) {
-  for (uint8_t y = 0; y < panelHeight; y++) {
-    for (uint8_t x = 0; x < panelWidth / 2; x++) {
-      const uint8_t xo = panelWidth - 1 - x;
-      const uint8_t yo = panelHeight - 1 - y;
-      CRGB tmp       = panel(x, y);
-      panel(x, y)    = panel(xo, yo);
-      panel(xo, yo)  = tmp;
-    }
-  }
+  pixelBoard.show();
 }
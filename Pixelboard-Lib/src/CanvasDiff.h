@@ -0,0 +1,61 @@
+/**
+ * @file CanvasDiff.h
+ * @brief Änderungserkennung für ein Canvas (HORIZONTAL_MATRIX)
+ *
+ * Vergleicht das frisch gerenderte Canvas mit dem zuletzt angezeigten Stand und
+ * liefert das Rechteck, in dem sich Pixel geändert haben. Ist es leer, kann der
+ * Frame samt Blit und FastLED.show() komplett entfallen.
+ */
+
+#ifndef CANVAS_DIFF_H
+#define CANVAS_DIFF_H
+
+#include <FastLED.h>
+
+struct DirtyRect {
+  int16_t x0, y0, x1, y1;   // inklusive Grenzen
+
+  bool istLeer() const { return x0 > x1; }
+};
+
+template <uint16_t tBreite, uint16_t tHoehe>
+class CanvasDiff {
+public:
+  // Liefert die geänderte Region und übernimmt das Canvas als neuen Stand
+  DirtyRect vergleiche(const CRGB *canvas) {
+    DirtyRect r = { tBreite, tHoehe, -1, -1 };
+
+    for (int16_t y = 0; y < tHoehe; y++) {
+      const CRGB *neu = &canvas[y * tBreite];
+      CRGB *alt = &m_Letztes[y * tBreite];
+
+      // Unveränderte Zeilen mit einem memcmp abhaken
+      if (m_Gueltig && memcmp(neu, alt, tBreite * sizeof(CRGB)) == 0) continue;
+
+      int16_t links = 0;
+      int16_t rechts = tBreite - 1;
+      if (m_Gueltig) {
+        while (neu[links] == alt[links]) links++;
+        while (neu[rechts] == alt[rechts]) rechts--;
+      }
+      if (links < r.x0) r.x0 = links;
+      if (rechts > r.x1) r.x1 = rechts;
+      if (y < r.y0) r.y0 = y;
+      r.y1 = y;
+
+      memcpy(alt, neu, tBreite * sizeof(CRGB));
+    }
+
+    m_Gueltig = true;
+    return r;
+  }
+
+  // Nächster Vergleich meldet das ganze Canvas als geändert
+  void invalidiere() { m_Gueltig = false; }
+
+private:
+  CRGB m_Letztes[tBreite * tHoehe];
+  bool m_Gueltig = false;
+};
+
+#endif
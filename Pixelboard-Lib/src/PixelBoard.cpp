@@ -0,0 +1,180 @@
+#include "PixelBoard.h"
+#include <math.h>
+
+PixelBoard pixelBoard;
+
+// Stromaufnahme einer WS2812 in mA bei voll aufgedrehtem Kanal bzw. im Ruhezustand,
+// dieselben Werte wie in FastLEDs power_mgt
+#define STROM_ROT_MA      16
+#define STROM_GRUEN_MA    11
+#define STROM_BLAU_MA     15
+#define STROM_RUHE_MA      1
+
+// Höchstens so viele Stufen pro Frame heller werden, dunkler geht sofort
+#define HELLIGKEIT_RAMPE   4
+// Erst heller werden, wenn das Ziel mindestens so viel über dem aktuellen Wert liegt
+#define HELLIGKEIT_HYSTERESE 2
+
+void PixelBoard::begin(uint8_t helligkeit, bool doppelpuffer) {
+  // Den zweiten Puffer zahlt nur, wer ihn braucht: Doppelpuffer oder Gamma
+  if ((doppelpuffer || m_GammaAktiv) && m_Zweitpuffer == nullptr) {
+    m_Zweitpuffer = new CRGB[ANZAHL_LEDS]();
+  }
+  // Beide Streifen zeigen direkt in den gemeinsamen Framebuffer,
+  // mit Gamma-Tabelle in den zweiten Puffer, der nur für die Ausgabe da ist
+  CRGB *ausgabe = m_GammaAktiv ? m_Zweitpuffer : m_Leds;
+  m_Streifen[0] = &FastLED.addLeds<WS2812, PIXELBOARD_PIN_0, GRB>(ausgabe, 0, LEDS_PRO_PANEL);
+  m_Streifen[1] = &FastLED.addLeds<WS2812, PIXELBOARD_PIN_1, GRB>(ausgabe, LEDS_PRO_PANEL, LEDS_PRO_PANEL);
+  m_Helligkeit = m_AktuelleHelligkeit = helligkeit;
+  FastLED.setBrightness(helligkeit);
+  FastLED.clear(true);
+
+  if (doppelpuffer) {
+    m_Gesendet = xSemaphoreCreateBinary();
+    xSemaphoreGive(m_Gesendet);
+    // Kern 0, die Apps zeichnen in loop() auf Kern 1
+    xTaskCreatePinnedToCore(showTask, "PixelBoard", 2048, this, 2, &m_ShowTask, 0);
+  }
+}
+
+void PixelBoard::show() {
+  uint32_t t = micros();
+  // Beim ersten show() ohne beginneFrame() gibt es keinen Startpunkt, die Zeit
+  // seit dem Booten (mit WLAN-Aufbau usw.) würde sonst p99 verfälschen
+  if (m_FrameStartUs != 0) m_Profil.erfasse(PHASE_ZEICHNEN, t - m_FrameStartUs);
+
+  if (m_ShowTask != nullptr) {
+    // Erst weiter, wenn der vorherige Frame komplett draußen ist: bis dahin
+    // liest der Show-Task noch den Ausgabepuffer und FastLEDs Helligkeit
+    xSemaphoreTake(m_Gesendet, portMAX_DELAY);
+    const uint32_t jetzt = micros();
+    m_Profil.erfasse(PHASE_WARTEN, jetzt - t);
+    t = jetzt;
+    // Das Senden des vorherigen Frames ist jetzt sicher abgeschlossen
+    if (m_FrameUnterwegs) m_Profil.erfasse(PHASE_SENDEN, m_SendenUs);
+    m_FrameUnterwegs = true;
+  }
+
+  begrenzeStrom();
+  const uint32_t jetzt = micros();
+  m_Profil.erfasse(PHASE_STROM, jetzt - t);
+  t = jetzt;
+
+  if (m_ShowTask == nullptr) {
+    if (m_GammaAktiv) fuelleAusgabe();
+    FastLED.show();
+    m_FrameStartUs = micros();
+    m_Profil.erfasse(PHASE_SENDEN, m_FrameStartUs - t);
+    return;
+  }
+
+  if (m_GammaAktiv) {
+    // Die Tabelle schreibt in den Ausgabepuffer, der App-Puffer bleibt, wie er ist
+    fuelleAusgabe();
+    xTaskNotifyGive(m_ShowTask);
+    m_FrameStartUs = micros();
+    return;
+  }
+
+  CRGB *vorne = m_Leds;
+  m_Leds = (vorne == m_Puffer) ? m_Zweitpuffer : m_Puffer;
+  m_Streifen[0]->setLeds(vorne, LEDS_PRO_PANEL);
+  m_Streifen[1]->setLeds(vorne + LEDS_PRO_PANEL, LEDS_PRO_PANEL);
+
+  // Die App zeichnet auf dem gerade gezeigten Stand weiter, wie mit einem Puffer
+  memcpy(m_Leds, vorne, sizeof(m_Puffer));
+  xTaskNotifyGive(m_ShowTask);
+  m_FrameStartUs = micros();
+}
+
+void PixelBoard::showTask(void *parameter) {
+  PixelBoard *board = static_cast<PixelBoard *>(parameter);
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    // FastLED startet beide RMT-Kanäle und wartet am Ende auf beide
+    const uint32_t start = micros();
+    FastLED.show();
+    board->m_SendenUs = micros() - start;
+    // Hier und nicht in EngineEvents::onEndShowLeds: das kommt an derselben
+    // Stelle, aber auch nach jedem anderen FastLED.show() im Programm
+    xSemaphoreGive(board->m_Gesendet);
+  }
+}
+
+void PixelBoard::zaehleSummen() {
+  // Nur nach rohem Zugriff über leds(), sonst werden die Summen mitgeführt
+  int32_t r = 0, g = 0, b = 0;
+  for (uint16_t i = 0; i < ANZAHL_LEDS; i++) {
+    r += licht(0, m_Leds[i].r);
+    g += licht(1, m_Leds[i].g);
+    b += licht(2, m_Leds[i].b);
+  }
+  m_Summe[0] = r;
+  m_Summe[1] = g;
+  m_Summe[2] = b;
+  m_SummenGueltig = true;
+}
+
+void PixelBoard::begrenzeStrom() {
+  if (m_MaxMilliampere == 0) {
+    // Grenze abgeschaltet: gewünschte Helligkeit wiederherstellen
+    if (m_AktuelleHelligkeit != m_Helligkeit) {
+      m_AktuelleHelligkeit = m_Helligkeit;
+      FastLED.setBrightness(m_Helligkeit);
+    }
+    return;
+  }
+  if (!m_SummenGueltig) zaehleSummen();
+
+  // Strom bei Helligkeit 255, getrennt nach Farbanteil und Ruhestrom
+  const uint32_t farbeMa = ((uint32_t)m_Summe[0] * STROM_ROT_MA +
+                            (uint32_t)m_Summe[1] * STROM_GRUEN_MA +
+                            (uint32_t)m_Summe[2] * STROM_BLAU_MA) / 255;
+  const uint32_t ruheMa = (uint32_t)ANZAHL_LEDS * STROM_RUHE_MA;
+
+  uint32_t ziel = m_Helligkeit;
+  if (ruheMa >= m_MaxMilliampere) {
+    ziel = 0;
+  } else if (farbeMa * m_Helligkeit / 255 > m_MaxMilliampere - ruheMa) {
+    ziel = (m_MaxMilliampere - ruheMa) * 255 / farbeMa;
+  }
+
+  uint8_t neu = m_AktuelleHelligkeit;
+  if (ziel < neu) {
+    neu = ziel;
+  } else if (ziel >= (uint32_t)neu + HELLIGKEIT_HYSTERESE || ziel == m_Helligkeit) {
+    neu = (ziel - neu > HELLIGKEIT_RAMPE) ? neu + HELLIGKEIT_RAMPE : ziel;
+  }
+  if (neu != m_AktuelleHelligkeit) {
+    m_AktuelleHelligkeit = neu;
+    FastLED.setBrightness(neu);
+  }
+}
+
+bool PixelBoard::setzeGamma(float gamma, const CRGB &korrektur) {
+  // Streifen sind schon angemeldet: Ausgabepuffer bleibt, wie er ist
+  if (m_Streifen[0] != nullptr) return false;
+
+  m_GammaAktiv = (gamma > 0.0f);
+  // Einmal mit float rechnen, beim show() nur noch nachschlagen
+  for (uint8_t c = 0; c < 3; c++) {
+    for (uint16_t v = 0; v < 256; v++) {
+      uint8_t aus = (uint8_t)(powf(v / 255.0f, gamma) * korrektur.raw[c] + 0.5f);
+      // Wie scale8_video: was leuchten soll, geht nicht ganz aus
+      if (aus == 0 && v > 0 && korrektur.raw[c] > 0) aus = 1;
+      m_Tabelle[c][v] = aus;
+    }
+  }
+  // Summen für die Strombegrenzung mit der neuen Kurve zählen
+  m_SummenGueltig = false;
+  return true;
+}
+
+void PixelBoard::fuelleAusgabe() {
+  CRGB *ziel = m_Zweitpuffer;
+  for (uint16_t i = 0; i < ANZAHL_LEDS; i++) {
+    ziel[i].r = m_Tabelle[0][m_Leds[i].r];
+    ziel[i].g = m_Tabelle[1][m_Leds[i].g];
+    ziel[i].b = m_Tabelle[2][m_Leds[i].b];
+  }
+}
@@ -0,0 +1,280 @@
+/**
+ * @file PixelBoard.h
+ * @brief Gemeinsamer Anzeige-Treiber für das Pixelboard (zwei Panels an Pin 25 und 26)
+ *
+ * Ein einziger Framebuffer in Streifen-Reihenfolge: FastLED sendet direkt daraus,
+ * es gibt keine Zwischenkopien pro Panel. Die Umrechnung (x,y) -> LED-Index steckt
+ * in einer Tabelle, die der Compiler aus der Panel-Beschreibung berechnet.
+ *
+ * Mit Doppelpuffer gibt show() den fertigen Frame nur ab: ein eigener Task auf
+ * Kern 0 sendet ihn über beide Streifen, während die App schon in den zweiten
+ * Puffer zeichnet. leds() zeigt danach auf den anderen Puffer, den Zeiger also
+ * nicht über ein show() hinweg merken. Der zweite Puffer wird erst in begin()
+ * angelegt, und nur mit Doppelpuffer oder Gamma.
+ *
+ * Mit setzeGamma() geht jeder Kanal beim show() durch eine Tabelle aus Gamma
+ * und Farbkorrektur: eine Tabellenabfrage pro Kanal, berechnet nur einmal.
+ * Die Helligkeit bleibt bei FastLED, damit dessen Dithering bei geringer
+ * Helligkeit weiter gegen Farbstufen hilft. Reihenfolge:
+ *   pixelBoard.setzeGamma(2.2f);
+ *   pixelBoard.begin(helligkeit);
+ *
+ * Koordinaten: x = 0 links, y = 0 oben.
+ *
+ * Geometrie per build_flags im Projekt:
+ *   PIXELBOARD_PANEL_BREITE, PIXELBOARD_PANEL_HOEHE   Größe eines Panels (Standard 32x8)
+ *   PIXELBOARD_NEBENEINANDER                          0 = übereinander (Standard), 1 = nebeneinander
+ */
+
+#ifndef PIXELBOARD_H
+#define PIXELBOARD_H
+
+#include <stdint.h>
+#include <Arduino.h>
+#include <FastLED.h>
+#include "PixelBoardProfil.h"
+
+#ifndef PIXELBOARD_PANEL_BREITE
+#define PIXELBOARD_PANEL_BREITE  32
+#endif
+#ifndef PIXELBOARD_PANEL_HOEHE
+#define PIXELBOARD_PANEL_HOEHE    8
+#endif
+#ifndef PIXELBOARD_NEBENEINANDER
+#define PIXELBOARD_NEBENEINANDER  0
+#endif
+
+#define PIXELBOARD_PIN_0   25   // Streifen 0
+#define PIXELBOARD_PIN_1   26   // Streifen 1
+#define PIXELBOARD_PANELS   2
+#define PIXELBOARD_SCHWARZ  0xFFFF   // LED bekommt kein Canvas-Pixel -> schwarz
+
+// Wo ein Panel (VERTICAL_ZIGZAG, gerade Spalten laufen von oben nach unten) auf dem
+// Board sitzt. Der Index in der Tabelle ist der LED-Streifen.
+struct PanelPosition {
+  uint8_t x0, y0;     // linke obere Ecke auf dem Board
+  bool kopfueber;     // Panel ist um 180° gedreht montiert
+};
+
+struct PixelBoardGeometrie {
+  static constexpr uint8_t  PANEL_BREITE = PIXELBOARD_PANEL_BREITE;
+  static constexpr uint8_t  PANEL_HOEHE = PIXELBOARD_PANEL_HOEHE;
+  static constexpr uint8_t  BREITE = PIXELBOARD_NEBENEINANDER ? 2 * PANEL_BREITE : PANEL_BREITE;
+  static constexpr uint8_t  HOEHE = PIXELBOARD_NEBENEINANDER ? PANEL_HOEHE : 2 * PANEL_HOEHE;
+  static constexpr uint16_t LEDS_PRO_PANEL = PANEL_BREITE * PANEL_HOEHE;
+  static constexpr uint16_t ANZAHL_LEDS = PIXELBOARD_PANELS * LEDS_PRO_PANEL;
+};
+
+// Nebeneinander: Pin 25 links, Pin 26 rechts, beide aufrecht.
+// Übereinander:  Pin 26 oben aufrecht, Pin 25 unten kopfüber.
+constexpr PanelPosition pixelBoardPanels[PIXELBOARD_PANELS] = {
+#if PIXELBOARD_NEBENEINANDER
+  { 0,                       0, false },
+  { PIXELBOARD_PANEL_BREITE, 0, false }
+#else
+  { 0, PIXELBOARD_PANEL_HOEHE, true  },
+  { 0, 0,                      false }
+#endif
+};
+
+// Für jedes Board-Pixel (Zeile für Zeile) der Index im Framebuffer
+struct PixelBoardXYTabelle {
+  uint16_t index[PixelBoardGeometrie::ANZAHL_LEDS];
+};
+
+constexpr PixelBoardXYTabelle berechneXYTabelle() {
+  typedef PixelBoardGeometrie G;
+  PixelBoardXYTabelle t{};
+  for (uint8_t p = 0; p < PIXELBOARD_PANELS; p++) {
+    const PanelPosition &pos = pixelBoardPanels[p];
+    for (uint8_t ly = 0; ly < G::PANEL_HOEHE; ly++) {
+      for (uint8_t lx = 0; lx < G::PANEL_BREITE; lx++) {
+        // Montage auflösen, dann Zickzack innerhalb der Spalte
+        uint8_t sx = lx, sy = ly;
+        if (pos.kopfueber) {
+          sx = (G::PANEL_BREITE - 1) - lx;
+          sy = (G::PANEL_HOEHE - 1) - ly;
+        }
+        const uint16_t i = sx * G::PANEL_HOEHE + ((sx % 2) ? (G::PANEL_HOEHE - 1) - sy : sy);
+        t.index[(pos.y0 + ly) * G::BREITE + (pos.x0 + lx)] = p * G::LEDS_PRO_PANEL + i;
+      }
+    }
+  }
+  return t;
+}
+
+inline constexpr PixelBoardXYTabelle pixelBoardXY = berechneXYTabelle();
+
+// Canvas-Rechteck mit inklusiven Grenzen, x0 > x1 = leer
+struct CanvasBereich {
+  uint8_t x0, y0, x1, y1;
+};
+
+// Text-Canvas (cLEDMatrix HORIZONTAL_MATRIX, y = 0 unten) -> Framebuffer.
+// Für jede LED der Index ins Canvas oder PIXELBOARD_SCHWARZ, dazu pro Panel
+// der Canvas-Bereich, den es zeigt (für Teil-Updates).
+template <uint8_t tBreite, uint8_t tHoehe>
+struct CanvasAbbildung {
+  uint16_t quelle[PixelBoardGeometrie::ANZAHL_LEDS];
+  CanvasBereich panel[PIXELBOARD_PANELS];
+};
+
+// skalierungY: jede Canvas-Zeile wird so oft wiederholt
+// zeilenVersatz: Hardware-Korrektur, Bild um n Zeilen nach unten schieben
+template <uint8_t tBreite, uint8_t tHoehe>
+constexpr CanvasAbbildung<tBreite, tHoehe> berechneCanvasAbbildung(uint8_t skalierungY, uint8_t zeilenVersatz) {
+  typedef PixelBoardGeometrie G;
+  CanvasAbbildung<tBreite, tHoehe> t{};
+  for (uint8_t y = 0; y < G::HOEHE; y++) {
+    for (uint8_t x = 0; x < G::BREITE; x++) {
+      const int16_t yGross = ((G::HOEHE - 1) - y) - zeilenVersatz;
+      const int16_t yCanvas = yGross / skalierungY;
+      uint16_t q = PIXELBOARD_SCHWARZ;
+      if (yGross >= 0 && yCanvas < tHoehe && x < tBreite)
+        q = yCanvas * tBreite + x;
+      t.quelle[pixelBoardXY.index[y * G::BREITE + x]] = q;
+    }
+  }
+  for (uint8_t p = 0; p < PIXELBOARD_PANELS; p++) {
+    CanvasBereich b = { 255, 255, 0, 0 };
+    for (uint16_t i = p * G::LEDS_PRO_PANEL; i < (p + 1) * G::LEDS_PRO_PANEL; i++) {
+      const uint16_t q = t.quelle[i];
+      if (q == PIXELBOARD_SCHWARZ) continue;
+      const uint8_t cx = q % tBreite, cy = q / tBreite;
+      if (cx < b.x0) b.x0 = cx;
+      if (cx > b.x1) b.x1 = cx;
+      if (cy < b.y0) b.y0 = cy;
+      if (cy > b.y1) b.y1 = cy;
+    }
+    t.panel[p] = b;
+  }
+  return t;
+}
+
+class PixelBoard : public PixelBoardGeometrie {
+public:
+  // Beide Streifen anmelden, Helligkeit setzen, alles löschen.
+  // doppelpuffer: Senden im Hintergrund, Zeichnen und Senden laufen parallel
+  void begin(uint8_t helligkeit, bool doppelpuffer = false);
+
+  // Nur vor begin(): begin() entscheidet, aus welchem Puffer FastLED sendet.
+  // Danach wird der Aufruf abgelehnt (false) und nichts geändert.
+  // gamma 0 = aus (Standard), sonst z.B. 2.2.
+  // korrektur skaliert die Kanäle wie FastLEDs setCorrection().
+  bool setzeGamma(float gamma, const CRGB &korrektur = CRGB(255, 255, 255));
+
+  // Strombegrenzung bei 5 V, 0 = aus. Die Helligkeit wird vor jedem show() so
+  // weit abgesenkt, dass der geschätzte Strom unter der Grenze bleibt.
+  void setzeStromgrenze(uint16_t maxMilliampere) { m_MaxMilliampere = maxMilliampere; }
+  uint8_t aktuelleHelligkeit() const { return m_AktuelleHelligkeit; }
+
+  // Zeitmessung: beginneFrame() vor Update und Zeichnen aufrufen, sonst zählt
+  // die Phase "zeichnen" ab dem Ende des letzten show()
+  void beginneFrame() { m_FrameStartUs = micros(); }
+  PixelBoardProfil &profil() { return m_Profil; }
+
+  // Roher Zugriff: die Farbsummen werden beim nächsten show() neu gezählt
+  CRGB *leds() { m_SummenGueltig = false; return m_Leds; }
+
+  static uint16_t XY(uint8_t x, uint8_t y) { return pixelBoardXY.index[y * BREITE + x]; }
+  CRGB &operator()(uint8_t x, uint8_t y) { m_SummenGueltig = false; return m_Leds[XY(x, y)]; }
+
+  // Mit Bereichsprüfung, Pixel außerhalb werden ignoriert
+  void setPixel(int x, int y, const CRGB &farbe) {
+    if (x < 0 || x >= BREITE || y < 0 || y >= HOEHE) return;
+    CRGB &led = m_Leds[XY(x, y)];
+    // Nur die Differenz fließt in die Summen, kein Durchlauf über alle LEDs
+    m_Summe[0] += licht(0, farbe.r) - licht(0, led.r);
+    m_Summe[1] += licht(1, farbe.g) - licht(1, led.g);
+    m_Summe[2] += licht(2, farbe.b) - licht(2, led.b);
+    led = farbe;
+  }
+
+  void clear() {
+    fill_solid(m_Leds, ANZAHL_LEDS, CRGB::Black);
+    m_Summe[0] = m_Summe[1] = m_Summe[2] = 0;
+    m_SummenGueltig = true;
+  }
+
+  // Frame senden. Mit Doppelpuffer wartet das nur auf den vorherigen Frame,
+  // der neue Frame wird im Hintergrund gesendet.
+  void show();
+
+  // Ein Durchlauf über alle LEDs: Canvas skaliert und verschoben in den Framebuffer
+  template <uint8_t tBreite, uint8_t tHoehe>
+  void zeigeCanvas(const CanvasAbbildung<tBreite, tHoehe> &t, const CRGB *canvas) {
+    const uint16_t *q = t.quelle;
+    int32_t r = 0, g = 0, b = 0;
+    for (uint16_t i = 0; i < ANZAHL_LEDS; i++, q++) {
+      const CRGB c = (*q == PIXELBOARD_SCHWARZ) ? CRGB(0, 0, 0) : canvas[*q];
+      m_Leds[i] = c;
+      r += licht(0, c.r);
+      g += licht(1, c.g);
+      b += licht(2, c.b);
+    }
+    m_Summe[0] = r;
+    m_Summe[1] = g;
+    m_Summe[2] = b;
+    m_SummenGueltig = true;
+  }
+
+  // Nur die Panels neu mappen, die Pixel aus dem geänderten Canvas-Rechteck
+  // zeigen (inklusive Grenzen). false, wenn keins betroffen ist, dann ist
+  // auch kein show() nötig.
+  template <uint8_t tBreite, uint8_t tHoehe>
+  bool zeigeCanvas(const CanvasAbbildung<tBreite, tHoehe> &t, const CRGB *canvas,
+                   int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    bool betroffen = false;
+    for (uint8_t p = 0; p < PIXELBOARD_PANELS; p++) {
+      const CanvasBereich &b = t.panel[p];
+      if (b.x0 > b.x1 || x1 < b.x0 || x0 > b.x1 || y1 < b.y0 || y0 > b.y1) continue;
+      const uint16_t *q = &t.quelle[p * LEDS_PRO_PANEL];
+      CRGB *led = &m_Leds[p * LEDS_PRO_PANEL];
+      for (uint16_t i = 0; i < LEDS_PRO_PANEL; i++, q++, led++) {
+        const CRGB c = (*q == PIXELBOARD_SCHWARZ) ? CRGB(0, 0, 0) : canvas[*q];
+        m_Summe[0] += licht(0, c.r) - licht(0, led->r);
+        m_Summe[1] += licht(1, c.g) - licht(1, led->g);
+        m_Summe[2] += licht(2, c.b) - licht(2, led->b);
+        *led = c;
+      }
+      betroffen = true;
+    }
+    return betroffen;
+  }
+
+private:
+  static void showTask(void *parameter);
+  void zaehleSummen();
+  // Wert, den die LED nach der Gamma-Tabelle wirklich bekommt
+  uint8_t licht(uint8_t kanal, uint8_t wert) const { return m_GammaAktiv ? m_Tabelle[kanal][wert] : wert; }
+  void begrenzeStrom();
+  void fuelleAusgabe();
+
+  CRGB m_Puffer[ANZAHL_LEDS];
+  CRGB *m_Leds = m_Puffer;                         // hier zeichnet die App
+  CRGB *m_Zweitpuffer = nullptr;                   // nur mit Doppelpuffer oder Gamma (begin())
+                                                   // mit Gamma: die Ausgabe
+  CLEDController *m_Streifen[PIXELBOARD_PANELS] = {};
+  TaskHandle_t m_ShowTask = nullptr;               // nur mit Doppelpuffer
+  SemaphoreHandle_t m_Gesendet = nullptr;          // frei, wenn kein Frame unterwegs ist
+  volatile uint32_t m_SendenUs = 0;                // Dauer des letzten Sendens im Show-Task
+  bool m_FrameUnterwegs = false;
+
+  PixelBoardProfil m_Profil;
+  uint32_t m_FrameStartUs = 0;                     // 0: noch kein Frame begonnen
+
+  // Strombegrenzung
+  int32_t m_Summe[3] = {};                         // Summe von r, g, b über m_Leds, nach Gamma
+  bool m_SummenGueltig = true;
+  uint16_t m_MaxMilliampere = 0;
+  uint8_t m_Helligkeit = 255;                      // gewünscht
+  uint8_t m_AktuelleHelligkeit = 255;              // gerade gesendet
+
+  // Gamma-Tabelle
+  bool m_GammaAktiv = false;
+  uint8_t m_Tabelle[3][256];                       // Gamma und Korrektur je Kanal
+};
+
+extern PixelBoard pixelBoard;
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * @file PixelBoardProfil.h
+ * @brief Zeitmessung pro Frame, aufgeteilt nach Phasen, mit p50/p99
+ *
+ * PixelBoard misst bei jedem show(), wie lange die App gezeichnet hat, wie lange
+ * Strombegrenzung, Warten auf den vorherigen Frame und das Senden gedauert haben.
+ * Jede Phase hat ein Histogramm mit logarithmischen Klassen (vier pro Zweierpotenz,
+ * also höchstens ~19 % Abweichung), das reicht für Perzentile ohne Werte zu speichern.
+ * Ohne Arduino und FastLED, damit es auch am PC getestet werden kann; alsJson()
+ * schreibt deshalb direkt statt über fl::Json. Gemessen wird in PixelBoard::show(),
+ * FastLEDs EngineEvents melden nur Anfang und Ende von FastLED.show().
+ */
+
+#ifndef PIXELBOARD_PROFIL_H
+#define PIXELBOARD_PROFIL_H
+
+#include <stdint.h>
+#include <string.h>
+
+enum ProfilPhase : uint8_t {
+  PHASE_ZEICHNEN,   // beginneFrame() bzw. Ende des letzten show() bis show()
+  PHASE_STROM,      // Helligkeit für die Strombegrenzung berechnen
+  PHASE_WARTEN,     // show() wartet auf den vorherigen Frame (Doppelpuffer)
+  PHASE_SENDEN,     // FastLED.show(): Kodieren und Übertragung auf beiden Streifen
+  PHASE_ANZAHL
+};
+
+class ZeitHistogramm {
+public:
+  static const uint8_t KLASSEN = 64;   // bis 2^17 us, längere landen in der letzten
+
+  void reset() {
+    memset(m_Anzahl, 0, sizeof(m_Anzahl));
+    m_Gesamt = 0;
+    m_MaxUs = 0;
+  }
+
+  void erfasse(uint32_t us) {
+    uint8_t k = klasse(us);
+    m_Anzahl[k]++;
+    m_Gesamt++;
+    if (us > m_MaxUs) m_MaxUs = us;
+  }
+
+  uint32_t anzahl() const { return m_Gesamt; }
+  uint32_t maxUs() const { return m_MaxUs; }
+
+  // Obergrenze der Klasse, in der das Perzentil liegt (0 ohne Messwerte)
+  uint32_t perzentil(uint8_t prozent) const {
+    if (m_Gesamt == 0) return 0;
+    const uint32_t ziel = (m_Gesamt * prozent + 99) / 100;
+    uint32_t summe = 0;
+    for (uint8_t k = 0; k < KLASSEN; k++) {
+      summe += m_Anzahl[k];
+      if (summe < ziel) continue;
+      // Letzte Klasse ist nach oben offen
+      if (k == KLASSEN - 1) return m_MaxUs;
+      const uint32_t grenze = obergrenze(k);
+      return (grenze < m_MaxUs) ? grenze : m_MaxUs;
+    }
+    return m_MaxUs;
+  }
+
+private:
+  // 0..3 exakt, danach höchstes Bit plus die zwei Bits darunter
+  static uint8_t klasse(uint32_t us) {
+    if (us < 4) return us;
+    const uint8_t bit = 31 - __builtin_clz(us);
+    const uint16_t k = (bit - 1) * 4 + ((us >> (bit - 2)) & 3);
+    return (k < KLASSEN) ? k : KLASSEN - 1;
+  }
+
+  static uint32_t obergrenze(uint8_t k) {
+    if (k < 4) return k;
+    const uint8_t bit = k / 4 + 1;
+    return ((uint32_t)(4 + k % 4) << (bit - 2)) + (1UL << (bit - 2)) - 1;
+  }
+
+  uint32_t m_Anzahl[KLASSEN];   // wie m_Gesamt, damit Perzentile ohne reset() stimmen
+  uint32_t m_Gesamt = 0;
+  uint32_t m_MaxUs = 0;
+};
+
+class PixelBoardProfil {
+public:
+  PixelBoardProfil() { reset(); }
+
+  void reset() {
+    for (uint8_t p = 0; p < PHASE_ANZAHL; p++) m_Phase[p].reset();
+  }
+
+  void erfasse(ProfilPhase phase, uint32_t us) { m_Phase[phase].erfasse(us); }
+  const ZeitHistogramm &phase(ProfilPhase phase) const { return m_Phase[phase]; }
+  uint32_t frames() const { return m_Phase[PHASE_STROM].anzahl(); }
+
+  // Eine Zeile JSON, z.B. für den seriellen Monitor oder ein Skript am PC:
+  // {"frames":n,"zeichnen":{"n":..,"p50":..,"p99":..,"max":..},...}  Zeiten in us
+  // out: alles mit printf(), z.B. Serial
+  template <class tAusgabe>
+  void alsJson(tAusgabe &out) const {
+    static const char *const namen[PHASE_ANZAHL] = { "zeichnen", "strom", "warten", "senden" };
+    out.printf("{\"frames\":%lu", (unsigned long)frames());
+    for (uint8_t p = 0; p < PHASE_ANZAHL; p++) {
+      const ZeitHistogramm &h = m_Phase[p];
+      out.printf(",\"%s\":{\"n\":%lu,\"p50\":%lu,\"p99\":%lu,\"max\":%lu}", namen[p],
+                 (unsigned long)h.anzahl(), (unsigned long)h.perzentil(50),
+                 (unsigned long)h.perzentil(99), (unsigned long)h.maxUs());
+    }
+    out.printf("}\n");
+  }
+
+private:
+  ZeitHistogramm m_Phase[PHASE_ANZAHL];
+};
+
+#endif
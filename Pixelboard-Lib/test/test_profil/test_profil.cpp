@@ -0,0 +1,110 @@
+// Host-Tests für das Frame-Profil: pio test -e native (in Pixelboard-Lib)
+#include <unity.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include "PixelBoardProfil.h"
+
+// Sammelt, was alsJson() ausgibt, statt Serial
+struct TextAusgabe {
+    char text[512];
+    size_t laenge = 0;
+
+    void printf(const char *format, ...) {
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(text + laenge, sizeof(text) - laenge, format, args);
+        va_end(args);
+        if (n > 0) laenge += n;
+        if (laenge >= sizeof(text)) laenge = sizeof(text) - 1;
+    }
+};
+
+void setUp() {}
+void tearDown() {}
+
+void test_leer() {
+    ZeitHistogramm h;
+    h.reset();
+    TEST_ASSERT_EQUAL_UINT32(0, h.anzahl());
+    TEST_ASSERT_EQUAL_UINT32(0, h.perzentil(50));
+    TEST_ASSERT_EQUAL_UINT32(0, h.perzentil(99));
+}
+
+void test_kleine_werte_exakt() {
+    ZeitHistogramm h;
+    h.reset();
+    for (int i = 0; i < 1000; i++) h.erfasse(3);
+    TEST_ASSERT_EQUAL_UINT32(3, h.perzentil(50));
+    TEST_ASSERT_EQUAL_UINT32(3, h.perzentil(99));
+}
+
+// Obergrenze der Klasse, höchstens ~19 % über dem Messwert
+void test_perzentil_klassengrenze() {
+    ZeitHistogramm h;
+    h.reset();
+    for (int i = 0; i < 99; i++) h.erfasse(100);
+    h.erfasse(5000);
+    TEST_ASSERT_EQUAL_UINT32(111, h.perzentil(50));
+    TEST_ASSERT_EQUAL_UINT32(111, h.perzentil(99));
+    TEST_ASSERT_EQUAL_UINT32(5000, h.perzentil(100));
+    TEST_ASSERT_EQUAL_UINT32(5000, h.maxUs());
+}
+
+// Nie über den größten Messwert hinaus
+void test_perzentil_hoechstens_max() {
+    ZeitHistogramm h;
+    h.reset();
+    h.erfasse(100);
+    TEST_ASSERT_EQUAL_UINT32(100, h.perzentil(50));
+}
+
+// Über 2^17 us landet alles in der letzten Klasse, die den Maximalwert meldet
+void test_ueber_bereich() {
+    ZeitHistogramm h;
+    h.reset();
+    h.erfasse(1UL << 20);
+    h.erfasse(3UL << 20);
+    TEST_ASSERT_EQUAL_UINT32(3UL << 20, h.perzentil(50));
+}
+
+// Ohne reset() über mehr als 65535 Frames, wie in LED-Schrift und Zeitausgabe
+void test_ueber_65535_werte() {
+    ZeitHistogramm h;
+    h.reset();
+    for (uint32_t i = 0; i < 70000; i++) h.erfasse(10);
+    for (uint32_t i = 0; i < 70000; i++) h.erfasse(1000);
+    TEST_ASSERT_EQUAL_UINT32(140000, h.anzahl());
+    TEST_ASSERT_EQUAL_UINT32(11, h.perzentil(50));
+    TEST_ASSERT_EQUAL_UINT32(1000, h.perzentil(99));
+}
+
+void test_json() {
+    PixelBoardProfil profil;
+    profil.erfasse(PHASE_ZEICHNEN, 100);
+    profil.erfasse(PHASE_STROM, 2);
+    profil.erfasse(PHASE_SENDEN, 15000);
+    TextAusgabe ausgabe;
+    profil.alsJson(ausgabe);
+    TEST_ASSERT_EQUAL_STRING(
+        "{\"frames\":1"
+        ",\"zeichnen\":{\"n\":1,\"p50\":100,\"p99\":100,\"max\":100}"
+        ",\"strom\":{\"n\":1,\"p50\":2,\"p99\":2,\"max\":2}"
+        ",\"warten\":{\"n\":0,\"p50\":0,\"p99\":0,\"max\":0}"
+        ",\"senden\":{\"n\":1,\"p50\":15000,\"p99\":15000,\"max\":15000}}\n",
+        ausgabe.text);
+
+    profil.reset();
+    TEST_ASSERT_EQUAL_UINT32(0, profil.frames());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_leer);
+    RUN_TEST(test_kleine_werte_exakt);
+    RUN_TEST(test_perzentil_klassengrenze);
+    RUN_TEST(test_perzentil_hoechstens_max);
+    RUN_TEST(test_ueber_bereich);
+    RUN_TEST(test_ueber_65535_werte);
+    RUN_TEST(test_json);
+    return UNITY_END();
+}
@@ -0,0 +1,89 @@
+#ifndef FIXED_TIMESTEP_H
+#define FIXED_TIMESTEP_H
+
+#include <Arduino.h>
+
+// Spielschritte in festem Takt: die vergangene Zeit wird aufsummiert und in
+// ganze Schritte umgerechnet, der Rest bleibt für den nächsten Aufruf.
+// Dadurch driftet der Takt nicht, egal wie lange Update und Zeichnen dauern.
+class FixedTimestep {
+public:
+    static const uint8_t MAX_AUFHOLEN = 3; // mehr Schritte pro Aufruf werden verworfen
+
+    explicit FixedTimestep(uint32_t stepMs) : stepMs(stepMs) {}
+
+    void setStep(uint32_t ms) { stepMs = ms; }
+    uint32_t getStep() const { return stepMs; }
+
+    // Takt neu beginnen, der erste Schritt ist nach einer Schrittlänge fällig
+    void start(uint32_t now) {
+        lastMs = now;
+        accuMs = 0;
+    }
+
+    // Anzahl der seit dem letzten Aufruf fälligen Schritte
+    uint8_t dueSteps(uint32_t now) {
+        accuMs += now - lastMs;
+        lastMs = now;
+
+        uint32_t steps = accuMs / stepMs;
+        accuMs -= steps * stepMs;
+        if (steps > MAX_AUFHOLEN) {
+            // Nach einer langen Pause nicht im Zeitraffer nachholen
+            steps = MAX_AUFHOLEN;
+            accuMs = 0;
+        }
+        return steps;
+    }
+
+    // Wartezeit bis zum nächsten Schritt, z.B. für vTaskDelay
+    uint32_t msUntilNextStep(uint32_t now) const {
+        const uint32_t spent = accuMs + (now - lastMs);
+        return (spent >= stepMs) ? 0 : stepMs - spent;
+    }
+
+private:
+    uint32_t stepMs;
+    uint32_t lastMs = 0;
+    uint32_t accuMs = 0;
+};
+
+// Dauer von Update + Zeichnen pro Frame gegen ein Zeitbudget messen
+class FrameStats {
+public:
+    explicit FrameStats(uint32_t budgetUs) : budgetUs(budgetUs) {}
+
+    void setBudget(uint32_t us) { budgetUs = us; }
+
+    void begin() { startUs = micros(); }
+
+    void end() {
+        const uint32_t us = micros() - startUs;
+        frames++;
+        sumUs += us;
+        if (us > maxUs) maxUs = us;
+        if (us > budgetUs) overBudget++;
+    }
+
+    // Bericht über den letzten Zeitraum ausgeben und Zähler zurücksetzen
+    void report(Print &out) {
+        if (frames == 0) return;
+        out.printf("Frames: %lu, Schnitt %lu us, Max %lu us, Budget %lu us, ueberzogen %lu\n",
+                   (unsigned long)frames, (unsigned long)(sumUs / frames),
+                   (unsigned long)maxUs, (unsigned long)budgetUs, (unsigned long)overBudget);
+        frames = 0;
+        sumUs = 0;
+        maxUs = 0;
+        overBudget = 0;
+    }
+
+private:
+    uint32_t budgetUs;
+    uint32_t startUs = 0;
+    uint32_t frames = 0;
+    uint32_t sumUs = 0;
+    uint32_t maxUs = 0;
+    uint32_t overBudget = 0;
+};
+
+#endif
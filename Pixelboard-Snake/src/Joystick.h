@@ -13,6 +13,9 @@ enum JoystickRichtung {
     UNTEN = 4
 };
 
+// Quelle für die Analogwerte (Standard: analogRead, im Host-Test ein Stub)
+typedef int (*AnalogQuelle)(int pin);
+
 class Joystick : public EntprellterTaster {
 public:
     // Konstruktor
@@ -20,8 +23,12 @@ public:
              int deadzoneWert = 1000, int centerWert = 2048);
 
     // Methode zum Aktualisieren - MUSS regelmäßig aufgerufen werden!
+    // Liest X und Y genau einmal, alle Abfragen danach nutzen diese Werte
     void aktualisiere();
 
+    // Andere Quelle für die Analogwerte setzen
+    void setzeQuelle(AnalogQuelle quelle);
+
     // Richtungs-Abfragen (gibt -1, 0, oder 1 zurück)
     int getXRichtung();  // -1 = Links, 0 = Neutral, 1 = Rechts
     int getYRichtung();  // -1 = Oben, 0 = Neutral, 1 = Unten
@@ -49,14 +56,31 @@ public:
     // - wurdeLangeGedrueckt()   - Wurde lang gedrückt? (einmalig)
 
 private:
+    static const int ABTASTUNGEN = 3;  // Median über die letzten 3 Messungen
+    const int HYSTERESE = 150;         // so weit muss der Stick zurück, um eine Richtung zu verlassen
+
     const int pinX;
     const int pinY;
     const int deadzone;
     const int center;
+    AnalogQuelle quelle;
+
+    // Letzte Messungen pro Achse (Ringpuffer)
+    int messungenX[ABTASTUNGEN];
+    int messungenY[ABTASTUNGEN];
+    uint8_t messIndex;
+
+    // Gefilterte Richtung aus dem letzten aktualisiere()
+    int xRichtung;
+    int yRichtung;
 
     // Für "neue Richtung" Erkennung
     int letzteXRichtung;
     int letzteYRichtung;
+    int neueXRichtung;   // in diesem Zyklus neu eingenommene Richtung, 0 = keine
+    int neueYRichtung;
+
+    int bewerteAchse(int wert, int bisher) const;
 };
 
 #endif
@@ -0,0 +1,60 @@
+#ifndef SNAKE_BODY_H
+#define SNAKE_BODY_H
+
+#include <stdint.h>
+
+// Ein Körpersegment, 2 Byte statt 8 Byte wie ein int-Punkt
+struct Segment { uint8_t x, y; };
+
+// Schlangenkörper als Ringpuffer: Kopf vorne anhängen und Schwanz hinten
+// abnehmen sind O(1), beim Bewegen wird nichts mehr umkopiert.
+// Index 0 ist immer der Kopf, length() - 1 das Schwanzende.
+template <uint16_t tMax>
+class SnakeBody {
+    static_assert((tMax & (tMax - 1)) == 0, "Kapazität muss eine Zweierpotenz sein");
+
+public:
+    class Iterator {
+    public:
+        Iterator(const SnakeBody *body, uint16_t i) : body(body), i(i) {}
+        Segment operator*() const { return (*body)[i]; }
+        Iterator& operator++() { ++i; return *this; }
+        bool operator!=(const Iterator &other) const { return i != other.i; }
+    private:
+        const SnakeBody *body;
+        uint16_t i;
+    };
+
+    void clear() { headIndex = 0; count = 0; }
+
+    // Neuer Kopf vor dem bisherigen Kopf
+    void pushHead(int x, int y) {
+        headIndex = (headIndex - 1) & MASK;
+        segments[headIndex] = { (uint8_t)x, (uint8_t)y };
+        if (count < tMax) count++;
+    }
+
+    // Schwanzende entfernen
+    void popTail() {
+        if (count > 0) count--;
+    }
+
+    Segment operator[](uint16_t i) const { return segments[(headIndex + i) & MASK]; }
+    Segment head() const { return (*this)[0]; }
+    Segment tail() const { return (*this)[count - 1]; }
+    uint16_t length() const { return count; }
+    bool isFull() const { return count == tMax; }
+
+    // Vom Kopf zum Schwanz, z.B. für das Zeichnen
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end() const { return Iterator(this, count); }
+
+private:
+    static const uint16_t MASK = tMax - 1;
+
+    Segment segments[tMax];
+    uint16_t headIndex = 0;
+    uint16_t count = 0;
+};
+
+#endif
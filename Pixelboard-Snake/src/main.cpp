@@ -5,26 +5,27 @@
 
 #include <Arduino.h>
 #include <FastLED.h>
+#include <PixelBoard.h>
 #include "Joystick.h"
+#include "FixedTimestep.h"
+#include "OccupancyGrid.h"
+#include "SnakeBody.h"
 
 // =============================================================================
 // --- HARDWARE KONFIGURATION --------------------------------------------------
 // =============================================================================
 
-#define PIN_TOP         25
-#define PIN_BOTTOM      26
-
+// LED-Pins und Panel-Mapping: PixelBoard (Geometrie über build_flags)
 #define JOY_PIN_X       34
 #define JOY_PIN_Y       35
 #define JOY_PIN_SW      32
 
-#define MATRIX_WIDTH    64
-#define MATRIX_HEIGHT   16
-#define NUM_LEDS        (MATRIX_WIDTH * MATRIX_HEIGHT)
+#define MATRIX_WIDTH    PixelBoard::BREITE
+#define MATRIX_HEIGHT   PixelBoard::HOEHE
+#define NUM_LEDS        PixelBoard::ANZAHL_LEDS
 
 #define BRIGHTNESS      40
 
-CRGB leds[NUM_LEDS];
 Joystick joystick(JOY_PIN_X, JOY_PIN_Y, JOY_PIN_SW);
 
 // =============================================================================
@@ -59,8 +60,7 @@ struct Pos {
 };
 
 const int MAX_SNAKE = 256;
-Pos snake[MAX_SNAKE];
-int snakeLength = 3;
+SnakeBody<MAX_SNAKE> snake;  // Ringpuffer, snake[0] = Kopf
 
 enum Dir {
     RIGHT = 0,
@@ -75,46 +75,39 @@ Dir nextDir = RIGHT;
 Pos fruit;
 int score = 0;
 
+// Belegte Zellen + Liste freier Zellen für Kollision und Frucht in O(1)
+OccupancyGrid<NUM_LEDS> grid;
+
 // =============================================================================
 // --- TIMING ------------------------------------------------------------------
 // =============================================================================
 
-unsigned long lastMove = 0;
-unsigned long lastBlink = 0;
+FixedTimestep spielTakt(SPEED[MEDIUM]);
+FixedTimestep blinkTakt(500);
 bool blinkState = false;
 
+// Nur neu zeichnen und show() aufrufen, wenn sich etwas geändert hat
+bool neuZeichnen = true;
+
+// Update + Zeichnen + show() pro Frame, Budget wie im snake_game: ~30 FPS
+#define FRAME_BUDGET_US 33000UL
+FrameStats frameStats(FRAME_BUDGET_US);
+FixedTimestep berichtTakt(10000);
+
+// --- Prototypen --------------------------------------------------------------
+void initGame();
+void generateFruit();
+
 // =============================================================================
 // --- HILFSFUNKTIONEN ---------------------------------------------------------
 // =============================================================================
 
-// Berechne LED-Index für Position (X,Y)
-int getIndex(int x, int y) {
-    if (x < 0 || x >= MATRIX_WIDTH || y < 0 || y >= MATRIX_HEIGHT) {
-        return -1;
-    }
-    
-    // Vertical Zig-Zag Layout
-    int index;
-    if (x % 2 == 0) {
-        // Gerade Spalte: von oben nach unten
-        index = x * MATRIX_HEIGHT + y;
-    } else {
-        // Ungerade Spalte: von unten nach oben
-        index = x * MATRIX_HEIGHT + (MATRIX_HEIGHT - 1 - y);
-    }
-    
-    return index;
-}
-
 void setPixel(int x, int y, CRGB color) {
-    int idx = getIndex(x, y);
-    if (idx >= 0 && idx < NUM_LEDS) {
-        leds[idx] = color;
-    }
+    pixelBoard.setPixel(x, y, color);
 }
 
 void clearDisplay() {
-    fill_solid(leds, NUM_LEDS, CRGB::Black);
+    pixelBoard.clear();
 }
 
 // =============================================================================
@@ -141,17 +134,18 @@ void drawMenu() {
         setPixel(12, 12, CRGB::Yellow);
     }
     
-    FastLED.show();
 }
 
 void updateMenu() {
     if (joystick.neueRichtungOben()) {
         currentLevel = (Difficulty)((currentLevel - 1 + 3) % 3);
+        neuZeichnen = true;
         Serial.print("Level: ");
         Serial.println(currentLevel);
     }
     if (joystick.neueRichtungUnten()) {
         currentLevel = (Difficulty)((currentLevel + 1) % 3);
+        neuZeichnen = true;
         Serial.print("Level: ");
         Serial.println(currentLevel);
     }
@@ -159,6 +153,7 @@ void updateMenu() {
         Serial.println("START!");
         initGame();
         currentState = PLAYING;
+        neuZeichnen = true;
     }
 }
 
@@ -167,17 +162,20 @@ void updateMenu() {
 // =============================================================================
 
 void initGame() {
-    snakeLength = 3;
-    snake[0] = {MATRIX_WIDTH / 2, MATRIX_HEIGHT / 2};
-    snake[1] = {MATRIX_WIDTH / 2 - 1, MATRIX_HEIGHT / 2};
-    snake[2] = {MATRIX_WIDTH / 2 - 2, MATRIX_HEIGHT / 2};
+    grid.clear(MATRIX_WIDTH, MATRIX_HEIGHT);
+    snake.clear();
+    for (int i = 2; i >= 0; i--) {
+        snake.pushHead(MATRIX_WIDTH / 2 - i, MATRIX_HEIGHT / 2);
+        grid.occupy(MATRIX_WIDTH / 2 - i, MATRIX_HEIGHT / 2);
+    }
     
     currentDir = RIGHT;
     nextDir = RIGHT;
     score = 0;
     
     generateFruit();
-    lastMove = millis();
+    spielTakt.setStep(SPEED[currentLevel]);
+    spielTakt.start(millis());
     
     Serial.println("=== GAME START ===");
     Serial.print("Snake at: X=");
@@ -187,25 +185,16 @@ void initGame() {
 }
 
 void generateFruit() {
-    bool valid = false;
-    while (!valid) {
-        fruit.x = random(0, MATRIX_WIDTH);
-        fruit.y = random(0, MATRIX_HEIGHT);
-        
-        valid = true;
-        for (int i = 0; i < snakeLength; i++) {
-            if (snake[i].x == fruit.x && snake[i].y == fruit.y) {
-                valid = false;
-                break;
-            }
-        }
+    // Zufällige Zelle, auf der die Schlange nicht liegt
+    if (!grid.pickFree(random(0x7FFFFFFF), fruit.x, fruit.y)) {
+        fruit = {-1, -1};  // Spielfeld voll
     }
 }
 
 void moveSnake() {
     currentDir = nextDir;
     
-    Pos newHead = snake[0];
+    Pos newHead = {snake.head().x, snake.head().y};
     
     switch (currentDir) {
         case RIGHT: newHead.x++; break;
@@ -223,32 +212,32 @@ void moveSnake() {
     }
     
     // Kollision mit sich selbst
-    for (int i = 0; i < snakeLength; i++) {
-        if (newHead.x == snake[i].x && newHead.y == snake[i].y) {
-            currentState = GAME_OVER;
-            Serial.println("GAME OVER: Self");
-            return;
-        }
+    if (grid.isOccupied(newHead.x, newHead.y)) {
+        currentState = GAME_OVER;
+        Serial.println("GAME OVER: Self");
+        return;
     }
     
     // Frucht gegessen?
     bool eatFruit = (newHead.x == fruit.x && newHead.y == fruit.y);
+    bool grow = eatFruit && !snake.isFull();
+    
+    // Ohne Wachstum wird die Zelle am Schwanzende frei
+    if (!grow) {
+        grid.release(snake.tail().x, snake.tail().y);
+        snake.popTail();
+    }
+    
+    // Snake verschieben: nur neuen Kopf anhängen
+    snake.pushHead(newHead.x, newHead.y);
+    grid.occupy(newHead.x, newHead.y);
     
     if (eatFruit) {
         score++;
         Serial.print("Score: ");
         Serial.println(score);
-        if (snakeLength < MAX_SNAKE) {
-            snakeLength++;
-        }
         generateFruit();
     }
-    
-    // Snake verschieben
-    for (int i = snakeLength - 1; i > 0; i--) {
-        snake[i] = snake[i - 1];
-    }
-    snake[0] = newHead;
 }
 
 void updateGame() {
@@ -266,12 +255,13 @@ void updateGame() {
         nextDir = RIGHT;
     }
     
-    // Snake bewegen
-    unsigned long now = millis();
-    if (now - lastMove >= SPEED[currentLevel]) {
-        lastMove = now;
+    // Snake bewegen, so oft wie seit dem letzten Aufruf Schritte fällig sind
+    uint8_t schritte = spielTakt.dueSteps(millis());
+    for (uint8_t i = 0; i < schritte && currentState == PLAYING; i++) {
         moveSnake();
     }
+    if (schritte > 0) neuZeichnen = true;
+    if (currentState == GAME_OVER) blinkTakt.start(millis());
 }
 
 void drawGame() {
@@ -281,12 +271,10 @@ void drawGame() {
     setPixel(fruit.x, fruit.y, CRGB::Red);
     
     // Snake
-    for (int i = 0; i < snakeLength; i++) {
+    for (int i = 0; i < snake.length(); i++) {
         CRGB color = (i == 0) ? CRGB::Green : CRGB::Lime;
         setPixel(snake[i].x, snake[i].y, color);
     }
-    
-    FastLED.show();
 }
 
 // =============================================================================
@@ -302,19 +290,17 @@ void drawGameOver() {
             setPixel(MATRIX_WIDTH / 2 - 5 + i, MATRIX_HEIGHT / 2, CRGB::Red);
         }
     }
-    
-    FastLED.show();
 }
 
 void updateGameOver() {
-    unsigned long now = millis();
-    if (now - lastBlink >= 500) {
-        lastBlink = now;
+    if (blinkTakt.dueSteps(millis()) % 2) {
         blinkState = !blinkState;
+        neuZeichnen = true;
     }
     
     if (joystick.wurdeGedrueckt()) {
         currentState = MENU;
+        neuZeichnen = true;
         Serial.println("Back to menu");
     }
 }
@@ -328,10 +314,8 @@ void setup() {
     delay(100);
     Serial.println("\n=== SIMPLE SNAKE ===");
     
-    FastLED.addLeds<WS2812, PIN_TOP, GRB>(leds, 0, MATRIX_WIDTH * MATRIX_HEIGHT / 2);
-    FastLED.addLeds<WS2812, PIN_BOTTOM, GRB>(leds, MATRIX_WIDTH * MATRIX_HEIGHT / 2, MATRIX_WIDTH * MATRIX_HEIGHT / 2);
-    FastLED.setBrightness(BRIGHTNESS);
-    FastLED.clear(true);
+    // Doppelpuffer: das nächste Bild entsteht, während das letzte noch gesendet wird
+    pixelBoard.begin(BRIGHTNESS, true);
     
     randomSeed(analogRead(0));
     
@@ -340,7 +324,7 @@ void setup() {
     setPixel(MATRIX_WIDTH - 1, 0, CRGB::Red);
     setPixel(0, MATRIX_HEIGHT - 1, CRGB::Blue);
     setPixel(MATRIX_WIDTH - 1, MATRIX_HEIGHT - 1, CRGB::Green);
-    FastLED.show();
+    pixelBoard.show();
     delay(2000);
     
     Serial.println("Ready!");
@@ -348,21 +332,42 @@ void setup() {
 
 void loop() {
     joystick.aktualisiere();
+    frameStats.begin();
+    pixelBoard.beginneFrame();
     
     switch (currentState) {
         case MENU:
             updateMenu();
-            drawMenu();
             break;
             
         case PLAYING:
             updateGame();
-            drawGame();
             break;
             
         case GAME_OVER:
             updateGameOver();
-            drawGameOver();
             break;
     }
+    
+    // Ein show() überträgt 2 x 512 LEDs, daher nur bei geändertem Bild.
+    // Gesendet wird im Hintergrund, show() wartet nur auf den vorherigen Frame.
+    if (neuZeichnen) {
+        switch (currentState) {
+            case MENU:      drawMenu();     break;
+            case PLAYING:   drawGame();     break;
+            case GAME_OVER: drawGameOver(); break;
+        }
+        pixelBoard.show();
+        neuZeichnen = false;
+        frameStats.end();
+    }
+    
+    if (berichtTakt.dueSteps(millis())) {
+        frameStats.report(Serial);
+        // Aufteilung nach Phasen, p50/p99 in us
+        pixelBoard.profil().alsJson(Serial);
+        pixelBoard.profil().reset();
+    }
+    
+    delay(1);
 }
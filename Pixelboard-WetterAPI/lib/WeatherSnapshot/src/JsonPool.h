@@ -0,0 +1,72 @@
+#ifndef JSON_POOL_H
+#define JSON_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <ArduinoJson.h>
+
+// Fester Speicher für ein JsonDocument statt Heap. Blöcke werden nur hinten
+// angehängt; der jeweils letzte Block kann wachsen, schrumpfen oder
+// zurückgegeben werden. Alles andere wird erst mit zuruecksetzen() frei,
+// deshalb vor jedem neuen Dokument aufrufen. Ist der Speicher voll, meldet
+// ArduinoJson DeserializationError::NoMemory.
+template <size_t tGroesse>
+class JsonPool : public ArduinoJson::Allocator {
+public:
+  void zuruecksetzen() {
+    benutzt = 0;
+    letzter = nullptr;
+  }
+
+  // Größter Füllstand seit dem Start, zum Einstellen von tGroesse
+  size_t hoechststand() const { return spitze; }
+
+  void *allocate(size_t n) override {
+    const size_t gesamt = KOPF + aufrunden(n);
+    if (gesamt > tGroesse - benutzt) return nullptr;
+    uint8_t *block = speicher + benutzt;
+    *(size_t *)block = n;
+    benutzt += gesamt;
+    if (benutzt > spitze) spitze = benutzt;
+    letzter = block + KOPF;
+    return letzter;
+  }
+
+  void deallocate(void *p) override {
+    if (p != nullptr && p == letzter) {
+      benutzt = (uint8_t *)p - KOPF - speicher;
+      letzter = nullptr;
+    }
+  }
+
+  void *reallocate(void *p, size_t n) override {
+    if (p == nullptr) return allocate(n);
+    uint8_t *block = (uint8_t *)p - KOPF;
+    if (p == letzter) {
+      // Letzter Block: an Ort und Stelle ändern
+      const size_t anfang = block - speicher;
+      if (KOPF + aufrunden(n) > tGroesse - anfang) return nullptr;
+      *(size_t *)block = n;
+      benutzt = anfang + KOPF + aufrunden(n);
+      if (benutzt > spitze) spitze = benutzt;
+      return p;
+    }
+    const size_t alt = *(size_t *)block;
+    void *neu = allocate(n);
+    if (neu != nullptr) memcpy(neu, p, (alt < n) ? alt : n);
+    return neu;
+  }
+
+private:
+  static const size_t KOPF = 8;   // Blockgröße, hält die Daten 8-Byte-ausgerichtet
+
+  static size_t aufrunden(size_t n) { return (n + 7) & ~(size_t)7; }
+
+  alignas(8) uint8_t speicher[tGroesse];
+  size_t benutzt = 0;
+  size_t spitze = 0;
+  void *letzter = nullptr;
+};
+
+#endif
@@ -0,0 +1,45 @@
+#include "WeatherSnapshot.h"
+#include "JsonPool.h"
+
+// ArduinoJson holt Speicher für Werte in ganzen Pools auf einmal und gibt den
+// Rest danach zurück, dazu kommen die sieben Schlüssel und zwei Texte.
+// 6 KB reichen dafür mit Abstand, hoechststand() zeigt den echten Bedarf.
+#define WETTER_JSON_SPEICHER 6144
+
+static JsonPool<WETTER_JSON_SPEICHER> wetterSpeicher;
+
+// Filter: alles andere (coord, sys, clouds, ...) wird beim Lesen übersprungen.
+// Wird beim ersten Aufruf einmal gebaut und dann wiederverwendet.
+static JsonDocument &wetterFilter() {
+  static JsonDocument filter = [] {
+    JsonDocument f;
+    f["name"] = true;
+    f["main"]["temp"] = true;
+    f["main"]["feels_like"] = true;
+    f["main"]["humidity"] = true;
+    f["main"]["pressure"] = true;
+    f["wind"]["speed"] = true;
+    f["weather"][0]["description"] = true;
+    return f;
+  }();
+  return filter;
+}
+
+DeserializationError parseWeather(Stream &eingabe, WeatherSnapshot &wetter) {
+  // Das Dokument enthält danach nur noch die sieben Felder, alles im festen Speicher
+  wetterSpeicher.zuruecksetzen();
+  JsonDocument doc(&wetterSpeicher);
+  DeserializationError error = deserializeJson(doc, eingabe, DeserializationOption::Filter(wetterFilter()));
+  if (error) {
+    return error;
+  }
+
+  strlcpy(wetter.stadt, doc["name"] | "", sizeof(wetter.stadt));
+  wetter.temp = doc["main"]["temp"];
+  wetter.gefuehlt = doc["main"]["feels_like"];
+  wetter.luftfeuchte = doc["main"]["humidity"];
+  wetter.luftdruck = doc["main"]["pressure"];
+  wetter.wind = doc["wind"]["speed"];
+  strlcpy(wetter.beschreibung, doc["weather"][0]["description"] | "", sizeof(wetter.beschreibung));
+  return error;
+}
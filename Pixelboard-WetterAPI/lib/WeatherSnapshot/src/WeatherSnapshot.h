@@ -0,0 +1,25 @@
+#ifndef WEATHER_SNAPSHOT_H
+#define WEATHER_SNAPSHOT_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Die Felder, die wir aus der OpenWeatherMap-Antwort brauchen.
+// Feste Größe: kein String, keine Heap-Allokation pro Abruf.
+struct WeatherSnapshot {
+  char stadt[32];
+  float temp;
+  float gefuehlt;
+  int luftfeuchte;
+  int luftdruck;
+  float wind;
+  char beschreibung[48];
+};
+
+// Liest die JSON-Antwort direkt aus dem Stream (HTTP-Body, Datei oder
+// Test-Puffer) und übernimmt nur die gefilterten Felder in 'wetter'.
+// Ohne Heap: das Dokument liegt in einem festen Speicher, der Filter wird
+// nur einmal gebaut. Nicht gleichzeitig aus mehreren Tasks aufrufen.
+DeserializationError parseWeather(Stream &eingabe, WeatherSnapshot &wetter);
+
+#endif
@@ -2,6 +2,7 @@
 #include <WiFi.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
+#include "WeatherSnapshot.h"
 
 // WiFi Zugangsdaten - HIER EINTRAGEN!
 const char* ssid = "iPhone von Paul";
@@ -46,6 +47,8 @@ void getWeatherData() {
     HTTPClient http;
     
     Serial.println("\n=== Wetterdaten abrufen ===");
+    // HTTP/1.0: kein Chunked-Encoding, der Body kann direkt geparst werden
+    http.useHTTP10(true);
     http.begin(serverPath.c_str());
     
     int httpResponseCode = http.GET();
@@ -54,51 +57,41 @@ void getWeatherData() {
       Serial.print("HTTP Response code: ");
       Serial.println(httpResponseCode);
       
-      String payload = http.getString();
-      
-      // JSON parsen
-      JsonDocument doc;
-      DeserializationError error = deserializeJson(doc, payload);
+      // JSON direkt aus dem Stream parsen, ohne die Antwort zu puffern
+      WeatherSnapshot wetter;
+      DeserializationError error = parseWeather(http.getStream(), wetter);
       
       if (error) {
         Serial.print("JSON Parsing fehlgeschlagen: ");
         Serial.println(error.c_str());
+        http.end();
         return;
       }
       
-      // Wetterdaten extrahieren
-      const char* cityName = doc["name"];
-      float temp = doc["main"]["temp"];
-      float feelsLike = doc["main"]["feels_like"];
-      int humidity = doc["main"]["humidity"];
-      int pressure = doc["main"]["pressure"];
-      float windSpeed = doc["wind"]["speed"];
-      const char* description = doc["weather"][0]["description"];
-      
       // Ausgabe auf dem Monitor
       Serial.println("\n╔═══════════════════════════════════════╗");
       Serial.println("║       WETTERDATEN INNSBRUCK          ║");
       Serial.println("╚═══════════════════════════════════════╝");
       Serial.println();
       Serial.print("🏙️  Stadt: ");
-      Serial.println(cityName);
+      Serial.println(wetter.stadt);
       Serial.print("🌡️  Temperatur: ");
-      Serial.print(temp);
+      Serial.print(wetter.temp);
       Serial.println(" °C");
       Serial.print("🤔 Gefühlt: ");
-      Serial.print(feelsLike);
+      Serial.print(wetter.gefuehlt);
       Serial.println(" °C");
       Serial.print("💧 Luftfeuchtigkeit: ");
-      Serial.print(humidity);
+      Serial.print(wetter.luftfeuchte);
       Serial.println(" %");
       Serial.print("📊 Luftdruck: ");
-      Serial.print(pressure);
+      Serial.print(wetter.luftdruck);
       Serial.println(" hPa");
       Serial.print("💨 Windgeschwindigkeit: ");
-      Serial.print(windSpeed);
+      Serial.print(wetter.wind);
       Serial.println(" m/s");
       Serial.print("☁️  Beschreibung: ");
-      Serial.println(description);
+      Serial.println(wetter.beschreibung);
       Serial.println("───────────────────────────────────────");
       
     } else {
@@ -0,0 +1,82 @@
+// Läuft auf dem Board: pio test -e esp32dev
+#include <Arduino.h>
+#include <unity.h>
+#include "WeatherSnapshot.h"
+
+// Aufgezeichnete OpenWeatherMap-Antwort (current weather, units=metric, lang=de)
+static const char antwort[] =
+  "{\"coord\":{\"lon\":16.3721,\"lat\":48.2085},"
+  "\"weather\":[{\"id\":803,\"main\":\"Clouds\",\"description\":\"überwiegend bewölkt\",\"icon\":\"04d\"}],"
+  "\"base\":\"stations\","
+  "\"main\":{\"temp\":12.34,\"feels_like\":11.2,\"temp_min\":10.93,\"temp_max\":13.87,"
+  "\"pressure\":1018,\"humidity\":76,\"sea_level\":1018,\"grnd_level\":990},"
+  "\"visibility\":10000,"
+  "\"wind\":{\"speed\":4.63,\"deg\":290,\"gust\":8.75},"
+  "\"clouds\":{\"all\":75},\"dt\":1760700000,"
+  "\"sys\":{\"type\":2,\"id\":2037452,\"country\":\"AT\",\"sunrise\":1760678042,\"sunset\":1760716321},"
+  "\"timezone\":7200,\"id\":2761369,\"name\":\"Wien\",\"cod\":200}";
+
+// Liefert einen festen Text wie der HTTP-Body, Zeichen für Zeichen
+class TextStream : public Stream {
+public:
+  explicit TextStream(const char *text) : text(text) {}
+  int available() override { return strlen(text + pos); }
+  int read() override { return text[pos] ? (uint8_t)text[pos++] : -1; }
+  int peek() override { return text[pos] ? (uint8_t)text[pos] : -1; }
+  size_t write(uint8_t) override { return 0; }
+
+private:
+  const char *text;
+  size_t pos = 0;
+};
+
+void setUp() {}
+void tearDown() {}
+
+void test_felder_aus_aufgezeichneter_antwort() {
+  TextStream eingabe(antwort);
+  WeatherSnapshot wetter;
+  DeserializationError error = parseWeather(eingabe, wetter);
+  TEST_ASSERT_TRUE(error == DeserializationError::Ok);
+  TEST_ASSERT_EQUAL_STRING("Wien", wetter.stadt);
+  TEST_ASSERT_EQUAL_FLOAT(12.34f, wetter.temp);
+  TEST_ASSERT_EQUAL_FLOAT(11.2f, wetter.gefuehlt);
+  TEST_ASSERT_EQUAL_INT(76, wetter.luftfeuchte);
+  TEST_ASSERT_EQUAL_INT(1018, wetter.luftdruck);
+  TEST_ASSERT_EQUAL_FLOAT(4.63f, wetter.wind);
+  TEST_ASSERT_EQUAL_STRING("überwiegend bewölkt", wetter.beschreibung);
+}
+
+void test_kein_heap_pro_abruf() {
+  WeatherSnapshot wetter;
+  // Erster Aufruf baut den Filter, danach darf sich der Heap nicht mehr ändern
+  TextStream erster(antwort);
+  parseWeather(erster, wetter);
+
+  const uint32_t frei = ESP.getFreeHeap();
+  for (int i = 0; i < 20; i++) {
+    TextStream eingabe(antwort);
+    TEST_ASSERT_TRUE(parseWeather(eingabe, wetter) == DeserializationError::Ok);
+  }
+  TEST_ASSERT_EQUAL_UINT32(frei, ESP.getFreeHeap());
+}
+
+void test_abgeschnittene_antwort() {
+  // Verbindung bricht mitten im Body ab
+  static const char abgeschnitten[] = "{\"main\":{\"temp\":12.34,\"feels_";
+  TextStream eingabe(abgeschnitten);
+  eingabe.setTimeout(10);  // nicht auf weitere Zeichen warten
+  WeatherSnapshot wetter;
+  TEST_ASSERT_TRUE(parseWeather(eingabe, wetter) == DeserializationError::IncompleteInput);
+}
+
+void setup() {
+  delay(2000);  // Zeit für den seriellen Monitor
+  UNITY_BEGIN();
+  RUN_TEST(test_felder_aus_aufgezeichneter_antwort);
+  RUN_TEST(test_kein_heap_pro_abruf);
+  RUN_TEST(test_abgeschnittene_antwort);
+  UNITY_END();
+}
+
+void loop() {}
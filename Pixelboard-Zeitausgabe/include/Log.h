@@ -0,0 +1,48 @@
+/**
+ * @file Log.h
+ * @brief Serielle Ausgaben mit Log-Level, das beim Kompilieren feststeht
+ *
+ * Ausgaben oberhalb von LOG_LEVEL werden vom Präprozessor entfernt, die
+ * Argumente werden dann gar nicht erst ausgewertet. Für die Fehlersuche in
+ * platformio.ini z.B. "build_flags = -D LOG_LEVEL=LOG_LEVEL_DEBUG" setzen.
+ */
+
+#ifndef LOG_H
+#define LOG_H
+
+#include <Arduino.h>
+
+#define LOG_LEVEL_NONE   0
+#define LOG_LEVEL_ERROR  1
+#define LOG_LEVEL_INFO   2
+#define LOG_LEVEL_DEBUG  3   // Ablauf jedes einzelnen Frames
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(...)    Serial.print(__VA_ARGS__)
+#define LOG_ERRORLN(...)  Serial.println(__VA_ARGS__)
+#else
+#define LOG_ERROR(...)    do {} while (0)
+#define LOG_ERRORLN(...)  do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(...)     Serial.print(__VA_ARGS__)
+#define LOG_INFOLN(...)   Serial.println(__VA_ARGS__)
+#else
+#define LOG_INFO(...)     do {} while (0)
+#define LOG_INFOLN(...)   do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...)    Serial.print(__VA_ARGS__)
+#define LOG_DEBUGLN(...)  Serial.println(__VA_ARGS__)
+#else
+#define LOG_DEBUG(...)    do {} while (0)
+#define LOG_DEBUGLN(...)  do {} while (0)
+#endif
+
+#endif
@@ -8,6 +8,9 @@
 #include <LEDText.h>
 #include <FontMatrise.h>
 #include <WiFi.h>
+#include <PixelBoard.h>
+#include "CanvasDiff.h"
+#include "Log.h"
 #include <time.h>
 
 // =============================================================================
@@ -33,58 +36,42 @@ int updateInterval = 50;           // Update-Intervall in ms (für flüssige Anz
 // --- Hardware-Konfiguration --------------------------------------------------
 // =============================================================================
 
-#define pinTop         25
-#define pinBottom      26
-
-#define panelWidth     32
-#define panelHeight     8
-
-#define ledsPerPanel   (panelWidth * panelHeight)
+// LED-Pins und Panel-Mapping stecken in PixelBoard
 #define brightness     25
-#define colorOrder     GRB
-#define chipset        WS2812
 
 // --- Virtuelles Canvas -------------------------------------------------------
-#define canvasWidth8   64
+// Nur so breit wie das Board, mehr Spalten wären ohnehin unsichtbar
+#define canvasWidth8   PixelBoard::BREITE
 #define canvasHeight8   8
 
-#define canvasWidth16  64
-#define canvasHeight16 16
-
 CRGB canvas8Leds[canvasWidth8 * canvasHeight8];
-CRGB canvas16Leds[canvasWidth16 * canvasHeight16];
 
 cLEDMatrix<canvasWidth8, canvasHeight8, HORIZONTAL_MATRIX> canvas8;
-cLEDMatrix<canvasWidth16, canvasHeight16, HORIZONTAL_MATRIX> canvas16;
-
-// --- Physische Panels --------------------------------------------------------
-CRGB ledsTop[ledsPerPanel];
-CRGB ledsBottom[ledsPerPanel];
 
-cLEDMatrix<panelWidth, panelHeight, VERTICAL_ZIGZAG_MATRIX> panelTop;
-cLEDMatrix<panelWidth, panelHeight, VERTICAL_ZIGZAG_MATRIX> panelBottom;
+// --- Canvas -> Board ---------------------------------------------------------
+// Canvas8 wird auf 16 Zeilen verdoppelt und eine Zeile nach unten geschoben.
+static constexpr auto canvasAbbildung = berechneCanvasAbbildung<canvasWidth8, canvasHeight8>(
+  2,  // skalierungY
+  1   // zeilenVersatz
+);
 
 // --- Text Objekt -------------------------------------------------------------
 cLEDText uhrzeitText;
 static uint32_t lastUpdateMs = 0;
 char uhrzeitString[6];  // "HH:MM" + null terminator
+static bool uhrzeitAngezeigt = false;
+
+// --- Änderungserkennung ------------------------------------------------------
+static CanvasDiff<canvasWidth8, canvasHeight8> canvasDiff;
 
 // --- Prototypen --------------------------------------------------------------
 static void initWLAN();
 static void initAnzeige();
 static void updateUhrzeit();
-static void scaleVertTo16();
-static void verschiebeCanvas16EineZeileNachUnten();
-static void blitPanelsFromCanvas16();
-static void mirrorPanelHorizontal(cLEDMatrix<panelWidth, panelHeight, VERTICAL_ZIGZAG_MATRIX> &panel);
-static void rotatePanel180(cLEDMatrix<panelWidth, panelHeight, VERTICAL_ZIGZAG_MATRIX> &panel);
 
 static inline void clearCanvas8() {
   fill_solid(canvas8Leds, canvasWidth8 * canvasHeight8, CRGB::Black);
 }
-static inline void clearCanvas16() {
-  fill_solid(canvas16Leds, canvasWidth16 * canvasHeight16, CRGB::Black);
-}
 
 // =============================================================================
 // --- Setup -------------------------------------------------------------------
@@ -243,29 +230,14 @@ static void initAnzeige() {
   Serial.println(F("LED INITIALISIERUNG STARTET"));
   Serial.println(F("========================================"));
   
-  // FastLED Setup
-  Serial.println(F("FastLED.addLeds() für Top Panel (Pin 25)..."));
-  FastLED.addLeds<chipset, pinTop, colorOrder>(ledsTop, ledsPerPanel);
-  
-  Serial.println(F("FastLED.addLeds() für Bottom Panel (Pin 26)..."));
-  FastLED.addLeds<chipset, pinBottom, colorOrder>(ledsBottom, ledsPerPanel);
-  
-  Serial.print(F("Setze Helligkeit auf: "));
+  // Beide Streifen (Pin 25 und 26) anmelden, Helligkeit setzen, alles löschen
+  Serial.print(F("PixelBoard starten, Helligkeit: "));
   Serial.println(brightness);
-  FastLED.setBrightness(brightness);
-  
-  Serial.println(F("Lösche alle LEDs..."));
-  FastLED.clear(true);
-
-  // Mapping Panel Objekte auf LED Arrays
-  Serial.println(F("Mappe Panel Objekte auf LED Arrays..."));
-  panelTop.SetLEDArray(ledsBottom);
-  panelBottom.SetLEDArray(ledsTop);
+  pixelBoard.begin(brightness);
 
   // Mapping Canvas
-  Serial.println(F("Initialisiere Canvas8 und Canvas16..."));
+  Serial.println(F("Initialisiere Canvas8..."));
   canvas8.SetLEDArray(canvas8Leds);
-  canvas16.SetLEDArray(canvas16Leds);
 
   // Text Initialisierung
   Serial.println(F("Initialisiere Text Objekt..."));
@@ -303,166 +275,109 @@ static void updateUhrzeit() {
   if (now - lastUpdateMs < (uint32_t)updateInterval) return;
   lastUpdateMs = now;
 
-  Serial.println(F("=== UPDATE UHRZEIT START ==="));
-  Serial.print(F("Millis: "));
-  Serial.println(now);
+  LOG_DEBUGLN(F("=== UPDATE UHRZEIT START ==="));
+  LOG_DEBUG(F("Millis: "));
+  LOG_DEBUGLN(now);
 
-  // WiFi Status prüfen
-  Serial.print(F("WiFi Status: "));
+  // WiFi Status prüfen, nur fürs Log: ohne DEBUG auch WiFi.status() sparen
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+  LOG_DEBUG(F("WiFi Status: "));
   if (WiFi.status() == WL_CONNECTED) {
-    Serial.println(F("Verbunden"));
+    LOG_DEBUGLN(F("Verbunden"));
   } else {
-    Serial.print(F("NICHT verbunden! Status Code: "));
-    Serial.println(WiFi.status());
+    LOG_DEBUG(F("NICHT verbunden! Status Code: "));
+    LOG_DEBUGLN(WiFi.status());
   }
+#endif
 
   // Aktuelle Zeit holen
+  char neueUhrzeit[sizeof(uhrzeitString)];
   struct tm timeinfo;
   if (!getLocalTime(&timeinfo)) {
-    Serial.println(F("FEHLER: getLocalTime() fehlgeschlagen!"));
-    strcpy(uhrzeitString, "--:--");
+    LOG_ERRORLN(F("FEHLER: getLocalTime() fehlgeschlagen!"));
+    strcpy(neueUhrzeit, "--:--");
   } else {
     // Zeit formatieren als HH:MM
-    sprintf(uhrzeitString, "%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
-    
+    sprintf(neueUhrzeit, "%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
+
     // Detaillierte Zeit Ausgabe
-    Serial.println(F("Zeit erfolgreich abgerufen:"));
-    Serial.print(F("  Datum: "));
-    Serial.print(timeinfo.tm_mday);
-    Serial.print(F("."));
-    Serial.print(timeinfo.tm_mon + 1);
-    Serial.print(F("."));
-    Serial.println(timeinfo.tm_year + 1900);
-    Serial.print(F("  Uhrzeit: "));
-    Serial.print(uhrzeitString);
-    Serial.print(F(" ("));
-    Serial.print(timeinfo.tm_hour);
-    Serial.print(F(":"));
-    Serial.print(timeinfo.tm_min);
-    Serial.print(F(":"));
-    Serial.print(timeinfo.tm_sec);
-    Serial.println(F(")"));
+    LOG_DEBUGLN(F("Zeit erfolgreich abgerufen:"));
+    LOG_DEBUG(F("  Datum: "));
+    LOG_DEBUG(timeinfo.tm_mday);
+    LOG_DEBUG(F("."));
+    LOG_DEBUG(timeinfo.tm_mon + 1);
+    LOG_DEBUG(F("."));
+    LOG_DEBUGLN(timeinfo.tm_year + 1900);
+    LOG_DEBUG(F("  Uhrzeit: "));
+    LOG_DEBUG(neueUhrzeit);
+    LOG_DEBUG(F(" ("));
+    LOG_DEBUG(timeinfo.tm_hour);
+    LOG_DEBUG(F(":"));
+    LOG_DEBUG(timeinfo.tm_min);
+    LOG_DEBUG(F(":"));
+    LOG_DEBUG(timeinfo.tm_sec);
+    LOG_DEBUGLN(F(")"));
   }
 
-  Serial.print(F("Anzuzeigender String: '"));
-  Serial.print(uhrzeitString);
-  Serial.print(F("' (Länge: "));
-  Serial.print(strlen(uhrzeitString));
-  Serial.println(F(")"));
+  // "HH:MM" ändert sich nur einmal pro Minute - sonst gibt es nichts zu tun
+  if (uhrzeitAngezeigt && strcmp(neueUhrzeit, uhrzeitString) == 0) {
+    LOG_DEBUGLN(F("Uhrzeit unverändert, Frame übersprungen"));
+    return;
+  }
+  strcpy(uhrzeitString, neueUhrzeit);
+
+  LOG_INFO(F("Neue Uhrzeit: "));
+  LOG_INFOLN(uhrzeitString);
 
   // Canvas löschen
-  Serial.println(F("Lösche Canvas8..."));
+  LOG_DEBUGLN(F("Lösche Canvas8..."));
   clearCanvas8();
 
   // Text setzen und zentrieren
-  Serial.println(F("Setze Text..."));
+  LOG_DEBUGLN(F("Setze Text..."));
   uhrzeitText.SetText((unsigned char*)uhrzeitString, strlen(uhrzeitString));
-  
+
   // Text zeichnen (statisch, mittig)
   int textWidth = strlen(uhrzeitString) * 6;
   int startX = (canvasWidth8 - textWidth) / 2;
-  
-  Serial.print(F("Text Breite (geschätzt): "));
-  Serial.print(textWidth);
-  Serial.print(F(" Pixel, Start X: "));
-  Serial.println(startX);
-  
-  // Position setzen und Text rendern
-  Serial.println(F("Rendere Text mit UpdateText()..."));
-  int renderResult = uhrzeitText.UpdateText();
-  Serial.print(F("UpdateText() Rückgabe: "));
-  Serial.println(renderResult);
-
-  // --- Skalieren auf 16px Höhe ---
-  Serial.println(F("Skaliere auf 16px..."));
-  scaleVertTo16();
-
-  // --- Verschieben (Hardware-Korrektur) ---
-  Serial.println(F("Verschiebe Canvas..."));
-  verschiebeCanvas16EineZeileNachUnten();
-
-  // --- Auf Panels mappen & Hardware-Fixes ---
-  Serial.println(F("Mappe auf Panels..."));
-  blitPanelsFromCanvas16();
-
-  // Anzeigen
-  Serial.println(F("FastLED.show()..."));
-  FastLED.show();
-  
-  Serial.println(F("=== UPDATE UHRZEIT ENDE ===\n"));
-}
 
-// =============================================================================
-// --- Hardware Helper Funktionen ----------------------------------------------
-// =============================================================================
-
-static void scaleVertTo16() {
-  for (uint8_t y8 = 0; y8 < canvasHeight8; y8++) {
-    const uint8_t y16a = 2 * y8;
-    const uint8_t y16b = y16a + 1;
-    for (uint8_t x = 0; x < canvasWidth8; x++) {
-      const CRGB c = canvas8(x, y8);
-      canvas16(x, y16a) = c;
-      canvas16(x, y16b) = c;
-    }
-  }
-}
-
-static void verschiebeCanvas16EineZeileNachUnten() {
-  for (int y = canvasHeight16 - 1; y > 0; y--) {
-    for (uint8_t x = 0; x < canvasWidth16; x++) {
-      canvas16(x, y) = canvas16(x, y - 1);
-    }
-  }
-  for (uint8_t x = 0; x < canvasWidth16; x++) {
-    canvas16(x, 0) = CRGB::Black;
-  }
-}
+  LOG_DEBUG(F("Text Breite (geschätzt): "));
+  LOG_DEBUG(textWidth);
+  LOG_DEBUG(F(" Pixel, Start X: "));
+  LOG_DEBUGLN(startX);
 
-static void blitPanelsFromCanvas16() {
-  // Oberes physisches Panel (Pin 26) bekommt logisches unten
-  for (uint8_t y = 0; y < panelHeight; y++) {
-    const uint8_t ySrc = y + panelHeight;
-    for (uint8_t x = 0; x < panelWidth; x++) {
-      panelTop(x, y) = canvas16(x, ySrc);
-    }
+  // Position setzen und Text rendern
+  LOG_DEBUGLN(F("Rendere Text mit UpdateText()..."));
+  int renderResult = uhrzeitText.UpdateText();
+  LOG_DEBUG(F("UpdateText() Rückgabe: "));
+  LOG_DEBUGLN(renderResult);
+
+  // --- Geänderte Region bestimmen ---
+  const DirtyRect dirty = canvasDiff.vergleiche(canvas8Leds);
+  uhrzeitAngezeigt = true;
+  if (dirty.istLeer()) {
+    LOG_DEBUGLN(F("Canvas unverändert, kein show()"));
+    return;
   }
-
-  // Unteres physisches Panel (Pin 25) bekommt logisches oben
-  for (uint8_t y = 0; y < panelHeight; y++) {
-    const uint8_t ySrc = y;
-    for (uint8_t x = 0; x < panelWidth; x++) {
-      panelBottom(x, y) = canvas16(x, ySrc);
-    }
+  LOG_DEBUG(F("Dirty Rect: "));
+  LOG_DEBUG(dirty.x0);
+  LOG_DEBUG(F(","));
+  LOG_DEBUG(dirty.y0);
+  LOG_DEBUG(F(" - "));
+  LOG_DEBUG(dirty.x1);
+  LOG_DEBUG(F(","));
+  LOG_DEBUGLN(dirty.y1);
+
+  // --- Nur betroffene Panels neu mappen (Skalieren, Verschieben, Spiegeln, Drehen) ---
+  LOG_DEBUGLN(F("Mappe auf Panels..."));
+  if (!pixelBoard.zeigeCanvas(canvasAbbildung, canvas8Leds, dirty.x0, dirty.y0, dirty.x1, dirty.y1)) {
+    LOG_DEBUGLN(F("Änderung außerhalb der Panels, kein show()"));
+    return;
   }
 
-  // Spiegelung an der y-Achse für beide Panels
-  mirrorPanelHorizontal(panelTop);
-  mirrorPanelHorizontal(panelBottom);
-
-  // Kopfüber montiertes Panel drehen
-  rotatePanel180(panelTop);
-}
+  // Anzeigen
+  LOG_DEBUGLN(F("pixelBoard.show()..."));
+  pixelBoard.show();
 
-static void mirrorPanelHorizontal(cLEDMatrix<panelWidth, panelHeight, VERTICAL_ZIGZAG_MATRIX> &panel) {
-  for (uint8_t y = 0; y < panelHeight; y++) {
-    for (uint8_t x = 0; x < panelWidth / 2; x++) {
-      const uint8_t xo = panelWidth - 1 - x;
-      CRGB tmp = panel(x, y);
-      panel(x, y) = panel(xo, y);
-      panel(xo, y) = tmp;
-    }
-  }
+  LOG_DEBUGLN(F("=== UPDATE UHRZEIT ENDE ===\n"));
 }
-
-static void rotatePanel180(cLEDMatrix<panelWidth, panelHeight, VERTICAL_ZIGZAG_MATRIX> &panel) {
-  for (uint8_t y = 0; y < panelHeight; y++) {
-    for (uint8_t x = 0; x < panelWidth / 2; x++) {
-      const uint8_t xo = panelWidth - 1 - x;
-      const uint8_t yo = panelHeight - 1 - y;
-      CRGB tmp = panel(x, y);
-      panel(x, y) = panel(xo, yo);
-      panel(xo, yo) = tmp;
-    }
-  }
-}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef INPUT_QUEUE_H
+#define INPUT_QUEUE_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "Joystick.h"
+
+// Was der Input-Task erkannt hat (nur Flanken, kein Dauerzustand)
+enum InputEventTyp : uint8_t {
+    EVT_RICHTUNG,    // Joystick zeigt in eine neue Richtung
+    EVT_KURZ,        // Taster kurz gedrückt und losgelassen
+    EVT_LANG         // Taster länger als 1 s gedrückt (im Spiel: zurück ins Menü)
+};
+
+struct InputEvent {
+    uint32_t zeit;               // millis() beim Erkennen, veraltete Drehungen verfallen
+    InputEventTyp typ;
+    JoystickRichtung richtung;   // nur bei EVT_RICHTUNG
+};
+
+// Ringpuffer für genau einen Schreiber (Input-Task) und einen Leser
+// (Game-Task). Jeder Index wird nur von einer Seite geschrieben, daher
+// reichen atomare Indizes, kein Mutex und keine Queue des Betriebssystems.
+template <uint8_t tGroesse>
+class InputQueue {
+    static_assert((tGroesse & (tGroesse - 1)) == 0, "Größe muss eine Zweierpotenz sein");
+
+public:
+    // Nur vom Schreiber aufrufen. false wenn voll, das Event geht verloren.
+    bool push(const InputEvent &e) {
+        const uint8_t k = kopf.load(std::memory_order_relaxed);
+        if ((uint8_t)(k - schwanz.load(std::memory_order_acquire)) == tGroesse) return false;
+        events[k & MASK] = e;
+        kopf.store(k + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Nur vom Leser aufrufen. false wenn leer.
+    bool pop(InputEvent &e) {
+        const uint8_t s = schwanz.load(std::memory_order_relaxed);
+        if (s == kopf.load(std::memory_order_acquire)) return false;
+        e = events[s & MASK];
+        schwanz.store(s + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static const uint8_t MASK = tGroesse - 1;
+
+    InputEvent events[tGroesse];
+    std::atomic<uint8_t> kopf{0};      // nächster freier Platz (Schreiber)
+    std::atomic<uint8_t> schwanz{0};   // ältestes Event (Leser)
+};
+
+#endif
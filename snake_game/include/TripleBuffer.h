@@ -0,0 +1,43 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <stdint.h>
+#include <atomic>
+
+// Drei Puffer für genau einen Schreiber (Game-Task) und einen Leser
+// (Display-Task). Der Schreiber füllt seinen Puffer und tauscht ihn gegen den
+// mittleren, der Leser tauscht seinen gegen den mittleren, wenn dort etwas
+// Neues liegt. Keiner wartet auf den anderen, und der Leser sieht immer ein
+// vollständiges Bild, nie eins, an dem gerade geschrieben wird.
+template <typename T>
+class TripleBuffer {
+public:
+    // Nur vom Schreiber: Puffer für das nächste Bild (Inhalt ist ein älteres Bild)
+    T &schreibpuffer() { return puffer[schreiben]; }
+
+    // Nur vom Schreiber: fertiges Bild abgeben
+    void veroeffentliche() {
+        schreiben = mitte.exchange(schreiben | NEU, std::memory_order_acq_rel) & INDEX;
+    }
+
+    // Nur vom Leser: neuestes Bild holen, false wenn seit dem letzten Mal keins kam
+    bool holeNeuestes() {
+        if (!(mitte.load(std::memory_order_relaxed) & NEU)) return false;
+        lesen = mitte.exchange(lesen, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+
+    // Nur vom Leser: das zuletzt geholte Bild
+    const T &lesepuffer() const { return puffer[lesen]; }
+
+private:
+    static const uint8_t INDEX = 0x03;
+    static const uint8_t NEU = 0x04;   // mittlerer Puffer wurde noch nicht gelesen
+
+    T puffer[3];
+    uint8_t schreiben = 0;             // gehört dem Schreiber
+    uint8_t lesen = 1;                 // gehört dem Leser
+    std::atomic<uint8_t> mitte{2};     // Index des mittleren Puffers + NEU
+};
+
+#endif
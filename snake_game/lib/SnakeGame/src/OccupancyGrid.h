@@ -0,0 +1,89 @@
+#ifndef OCCUPANCY_GRID_H
+#define OCCUPANCY_GRID_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Belegung des Spielfelds in O(1):
+// - ein Bit pro Zelle sagt, ob die Schlange dort liegt (Kollision)
+// - eine dichte Liste enthält alle Zellen, auf denen Futter erscheinen darf;
+//   jede Zelle kennt ihren Platz in der Liste, dadurch sind Einfügen,
+//   Entfernen und zufälliges Ziehen konstant schnell
+template <uint16_t tMaxZellen>
+class OccupancyGrid {
+public:
+    // Leeres Feld: nichts belegt, alle Zellen in der Liste
+    void clear(int width, int height) {
+        boardWidth = width;
+        memset(bits, 0, sizeof(bits));
+        freeCount = 0;
+        for (uint16_t z = 0; z < width * height; z++) {
+            listIndex[z] = freeCount;
+            freeList[freeCount++] = z;
+        }
+    }
+
+    bool isOccupied(int x, int y) const {
+        const uint16_t z = cell(x, y);
+        return (bits[z >> 5] >> (z & 31)) & 1;
+    }
+
+    // Schlange belegt die Zelle (Bit setzen, nicht mehr für Futter verfügbar)
+    void occupy(int x, int y) {
+        const uint16_t z = cell(x, y);
+        bits[z >> 5] |= (1UL << (z & 31));
+        removeFromList(z);
+    }
+
+    // Schlange verlässt die Zelle (Bit löschen, wieder für Futter verfügbar)
+    void release(int x, int y) {
+        const uint16_t z = cell(x, y);
+        bits[z >> 5] &= ~(1UL << (z & 31));
+        addToList(z);
+    }
+
+    // Zelle nur für Futter sperren/freigeben (Rand, anderes Futter)
+    void reserve(int x, int y) { removeFromList(cell(x, y)); }
+    void unreserve(int x, int y) { addToList(cell(x, y)); }
+
+    // Freie Zelle zu einer Zufallszahl, false wenn das Feld voll ist.
+    // Die Zahl kommt vom Aufrufer, damit das Spiel seinen eigenen Generator nutzen kann.
+    bool pickFree(uint32_t zufall, int &x, int &y) const {
+        if (freeCount == 0) return false;
+        const uint16_t z = freeList[zufall % freeCount];
+        x = z % boardWidth;
+        y = z / boardWidth;
+        return true;
+    }
+
+    uint16_t getFreeCount() const { return freeCount; }
+
+private:
+    static const uint16_t NOT_LISTED = 0xFFFF;
+
+    int boardWidth = 0;
+    uint32_t bits[(tMaxZellen + 31) / 32];
+    uint16_t freeList[tMaxZellen];
+    uint16_t listIndex[tMaxZellen];   // Platz in freeList oder NOT_LISTED
+    uint16_t freeCount = 0;
+
+    uint16_t cell(int x, int y) const { return y * boardWidth + x; }
+
+    void addToList(uint16_t z) {
+        if (listIndex[z] != NOT_LISTED) return;
+        listIndex[z] = freeCount;
+        freeList[freeCount++] = z;
+    }
+
+    // Lücke mit dem letzten Eintrag füllen
+    void removeFromList(uint16_t z) {
+        const uint16_t i = listIndex[z];
+        if (i == NOT_LISTED) return;
+        const uint16_t last = freeList[--freeCount];
+        freeList[i] = last;
+        listIndex[last] = i;
+        listIndex[z] = NOT_LISTED;
+    }
+};
+
+#endif
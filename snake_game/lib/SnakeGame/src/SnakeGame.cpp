@@ -0,0 +1,125 @@
+#include "SnakeGame.h"
+
+SnakeGame::SnakeGame(int width, int height, uint32_t seed) : boardWidth(width), boardHeight(height) {
+    // Initialisierung der Variablen
+    activeFoodCount = 1; 
+    this->seed(seed);
+    reset(1);
+}
+
+void SnakeGame::seed(uint32_t s) {
+    rngState = s ? s : 1; // xorshift bleibt bei 0 hängen
+}
+
+// xorshift32: schnell, ohne Plattform-Abhängigkeit und reproduzierbar
+uint32_t SnakeGame::nextRandom() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+void SnakeGame::reset(int foodCount) {
+    activeFoodCount = foodCount;
+    currentDir = DIR_RIGHT;
+
+    // Startposition: Mittig, aber so, dass wir nicht im Rand starten
+    int startX = boardWidth / 2;
+    int startY = boardHeight / 2;
+
+    // Rand ist für Futter gesperrt, Schlange belegt ihre Startzellen
+    grid.clear(boardWidth, boardHeight);
+    for (int x = 0; x < boardWidth; x++) {
+        grid.reserve(x, 0);
+        grid.reserve(x, boardHeight - 1);
+    }
+    for (int y = 1; y < boardHeight - 1; y++) {
+        grid.reserve(0, y);
+        grid.reserve(boardWidth - 1, y);
+    }
+
+    // 3 Segmente, zuletzt der Kopf ganz rechts
+    body.clear();
+    for (int i = 2; i >= 0; i--) {
+        body.pushHead(startX - i, startY);
+        grid.occupy(startX - i, startY);
+    }
+
+    // Alle Futter-Pixel initialisieren
+    for (int i = 0; i < activeFoodCount; i++) {
+        spawnFood(i);
+    }
+}
+
+bool SnakeGame::setDirection(Direction newDir) {
+    // Verhindert 180-Grad-Wenden (Selbstmord)
+    if (newDir == currentDir) return false;
+    if ((newDir == DIR_UP && currentDir != DIR_DOWN) ||
+        (newDir == DIR_DOWN && currentDir != DIR_UP) ||
+        (newDir == DIR_LEFT && currentDir != DIR_RIGHT) ||
+        (newDir == DIR_RIGHT && currentDir != DIR_LEFT)) {
+        currentDir = newDir;
+        return true;
+    }
+    return false;
+}
+
+void SnakeGame::spawnFood(int index) {
+    // Nur Zellen innerhalb des weißen Randes, nicht auf der Schlange und
+    // nicht auf anderem Futter stehen in der Liste
+    Point& food = foodItems[index];
+    if (!grid.pickFree(nextRandom(), food.x, food.y)) {
+        food = { -1, -1 }; // Feld ist voll, kein Platz mehr
+        return;
+    }
+    grid.reserve(food.x, food.y);
+}
+
+bool SnakeGame::isPointOnSnake(Point p) {
+    return grid.isOccupied(p.x, p.y);
+}
+
+bool SnakeGame::update() {
+    // 1. Neue Kopfposition berechnen
+    Point head = { body.head().x, body.head().y };
+    if (currentDir == DIR_UP) head.y--;
+    else if (currentDir == DIR_DOWN) head.y++;
+    else if (currentDir == DIR_LEFT) head.x--;
+    else if (currentDir == DIR_RIGHT) head.x++;
+
+    // 2. Kollision mit dem WEISSEN RAND prüfen
+    // Da der Rand bei 0 und Max liegt, stirbt die Schlange dort
+    if (head.x <= 0 || head.x >= boardWidth - 1 || 
+        head.y <= 0 || head.y >= boardHeight - 1) {
+        return false; 
+    }
+
+    // 3. Check: Frisst der Kopf IRGENDEIN Futter? (nur eins pro Frame möglich)
+    int eaten = -1;
+    for (int i = 0; i < activeFoodCount; i++) {
+        if (head.x == foodItems[i].x && head.y == foodItems[i].y) {
+            eaten = i;
+            break;
+        }
+    }
+
+    // 4. Ohne Wachstum räumt das Schwanzende seine Zelle
+    if (eaten < 0 || body.isFull()) {
+        Segment tail = body.tail();
+        grid.release(tail.x, tail.y);
+        body.popTail();
+    }
+
+    // 5. Kollision mit eigenem Körper
+    if (grid.isOccupied(head.x, head.y)) return false;
+
+    // 6. Kopf vorne anhängen
+    body.pushHead(head.x, head.y);
+    grid.occupy(head.x, head.y);
+
+    if (eaten >= 0) {
+        spawnFood(eaten); // Nur diesen einen gefressenen Punkt neu spawnen
+    }
+
+    return true;
+}
\ No newline at end of file
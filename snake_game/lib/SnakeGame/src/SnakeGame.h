@@ -0,0 +1,43 @@
+#ifndef SNAKE_GAME_H
+#define SNAKE_GAME_H
+
+// Nur Standard-Header: der Spielkern läuft auch ohne Arduino/FastLED (z.B. am PC)
+#include <stdint.h>
+#include "OccupancyGrid.h"
+#include "SnakeBody.h"
+
+#define MAX_SNAKE_LENGTH 512
+#define MAX_FOOD 5 // Maximal 5 Futter-Pixel gleichzeitig
+#define MAX_BOARD_CELLS (32 * 16) // Spielfeld inkl. Rand
+
+struct Point { int x, y; };
+enum Direction { DIR_UP, DIR_DOWN, DIR_LEFT, DIR_RIGHT };
+
+class SnakeGame {
+public:
+    SnakeGame(int width, int height, uint32_t seed = 1);
+    void seed(uint32_t s);  // gleicher Seed + gleiche Eingaben = gleicher Spielverlauf
+    void reset(int foodCount);
+    bool update();
+    bool setDirection(Direction newDir); // false = ungültig oder keine Änderung
+    
+    const SnakeBody<MAX_SNAKE_LENGTH>& getBody() { return body; }
+    int getLength() { return body.length(); }
+    Point* getFoodArray() { return foodItems; }
+    int getCurrentFoodCount() { return activeFoodCount; }
+
+private:
+    int boardWidth, boardHeight;
+    SnakeBody<MAX_SNAKE_LENGTH> body;
+    Direction currentDir;
+    Point foodItems[MAX_FOOD];
+    int activeFoodCount;
+    OccupancyGrid<MAX_BOARD_CELLS> grid;
+    uint32_t rngState;
+
+    uint32_t nextRandom();
+    void spawnFood(int index);
+    bool isPointOnSnake(Point p);
+};
+
+#endif
\ No newline at end of file
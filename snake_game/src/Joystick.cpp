@@ -1,123 +1,160 @@
 #include "Joystick.h"
 
-// Konstruktor
+static int leseAnalog(int pin) {
+    return analogRead(pin);
+}
+
+// Median aus drei Werten, filtert einzelne Ausreißer des ADC
+static int median3(int a, int b, int c) {
+    if (a > b) { int t = a; a = b; b = t; }
+    if (b > c) b = c;
+    return (a > b) ? a : b;
+}
+
+// Konstruktor: Initialisiert Joystick mit X-, Y- und Button-Pins
 Joystick::Joystick(int pinX, int pinY, int pinButton, int deadzoneWert, int centerWert)
-    : EntprellterTaster(pinButton),
+    : EntprellterTaster(pinButton), // Button-Funktionalität von Basisklasse
       pinX(pinX), 
       pinY(pinY), 
       deadzone(deadzoneWert), 
       center(centerWert),
+      quelle(leseAnalog),
+      messIndex(0),
+      xRichtung(0),
+      yRichtung(0),
       letzteXRichtung(0),
-      letzteYRichtung(0) {
+      letzteYRichtung(0),
+      neueXRichtung(0),
+      neueYRichtung(0) {
     
+    // Bis zur ersten Messung steht der Stick in der Mitte
+    for (int i = 0; i < ABTASTUNGEN; i++) {
+        messungenX[i] = centerWert;
+        messungenY[i] = centerWert;
+    }
+
+    // Analoge Pins als Input konfigurieren
     pinMode(pinX, INPUT);
     pinMode(pinY, INPUT);
 }
 
+void Joystick::setzeQuelle(AnalogQuelle neueQuelle) {
+    quelle = neueQuelle;
+}
+
+// Aktualisiere sowohl Joystick als auch Button-Zustand
 void Joystick::aktualisiere() {
+    // Button-Zustand aktualisieren (von Basisklasse)
     EntprellterTaster::aktualisiere();
+
+    // Pro Zyklus nur eine Wandlung je Achse, gefiltert wird über die letzten Zyklen
+    messungenX[messIndex] = quelle(pinX);
+    messungenY[messIndex] = quelle(pinY);
+    messIndex = (messIndex + 1) % ABTASTUNGEN;
+
+    xRichtung = bewerteAchse(median3(messungenX[0], messungenX[1], messungenX[2]), xRichtung);
+    yRichtung = bewerteAchse(median3(messungenY[0], messungenY[1], messungenY[2]), yRichtung);
+
+    // Flanken nur für diesen Zyklus merken
+    neueXRichtung = (xRichtung != letzteXRichtung) ? xRichtung : 0;
+    neueYRichtung = (yRichtung != letzteYRichtung) ? yRichtung : 0;
+    letzteXRichtung = xRichtung;
+    letzteYRichtung = yRichtung;
 }
 
-int Joystick::getXRichtung() {
-    int wert = analogRead(pinX);
-    
+// Wert -> Richtung, mit Hysterese an den Deadzone-Grenzen
+int Joystick::bewerteAchse(int wert, int bisher) const {
+    const int halteGrenze = deadzone - HYSTERESE;
+
+    if (bisher == -1 && wert < (center - halteGrenze)) return -1;
+    if (bisher == 1 && wert > (center + halteGrenze)) return 1;
+
     if (wert < (center - deadzone)) {
-        return -1;  // Links
+        return -1;
     } else if (wert > (center + deadzone)) {
-        return 1;   // Rechts
+        return 1;
     } else {
-        return 0;   // Neutral
+        return 0;
     }
 }
 
+// Gibt X-Richtung zurück: -1 (Links), 0 (Neutral), 1 (Rechts)
+int Joystick::getXRichtung() {
+    return xRichtung;
+}
+
+// Gibt Y-Richtung zurück: -1 (Oben), 0 (Neutral), 1 (Unten)
 int Joystick::getYRichtung() {
-    int wert = analogRead(pinY);
-    
-    if (wert < (center - deadzone)) {
-        return -1;  // Oben
-    } else if (wert > (center + deadzone)) {
-        return 1;   // Unten
-    } else {
-        return 0;   // Neutral
-    }
+    return yRichtung;
 }
 
+// Einfache Richtungs-Checks
 bool Joystick::istLinks() {
-    return getXRichtung() == -1;
+    return xRichtung == -1;
 }
 
 bool Joystick::istRechts() {
-    return getXRichtung() == 1;
+    return xRichtung == 1;
 }
 
 bool Joystick::istOben() {
-    return getYRichtung() == -1;
+    return yRichtung == -1;
 }
 
 bool Joystick::istUnten() {
-    return getYRichtung() == 1;
+    return yRichtung == 1;
 }
 
 bool Joystick::istNeutral() {
-    return (getXRichtung() == 0 && getYRichtung() == 0);
+    return (xRichtung == 0 && yRichtung == 0);
 }
 
+// Gibt die primäre Richtung als Enum zurück
+// Priorität: X-Achse vor Y-Achse bei diagonalen Bewegungen
 JoystickRichtung Joystick::getRichtung() {
-    int x = getXRichtung();
-    int y = getYRichtung();
+    // X-Achse hat Priorität
+    if (xRichtung == -1) return LINKS;
+    if (xRichtung == 1)  return RECHTS;
     
-    if (x == -1) return LINKS;
-    if (x == 1)  return RECHTS;
-    if (y == -1) return OBEN;
-    if (y == 1)  return UNTEN;
+    // Dann Y-Achse
+    if (yRichtung == -1) return OBEN;
+    if (yRichtung == 1)  return UNTEN;
     
     return NEUTRAL;
 }
 
+// Gibt TRUE zurück, wenn die Richtung GERADE NEU nach links bewegt wurde
 bool Joystick::neueRichtungLinks() {
-    int aktuelleRichtung = getXRichtung();
-    
-    if (aktuelleRichtung == -1 && letzteXRichtung != -1) {
-        letzteXRichtung = aktuelleRichtung;
+    if (neueXRichtung == -1) {
+        neueXRichtung = 0;
         return true;
     }
-    
-    letzteXRichtung = aktuelleRichtung;
     return false;
 }
 
+// Gibt TRUE zurück, wenn die Richtung GERADE NEU nach rechts bewegt wurde
 bool Joystick::neueRichtungRechts() {
-    int aktuelleRichtung = getXRichtung();
-    
-    if (aktuelleRichtung == 1 && letzteXRichtung != 1) {
-        letzteXRichtung = aktuelleRichtung;
+    if (neueXRichtung == 1) {
+        neueXRichtung = 0;
         return true;
     }
-    
-    letzteXRichtung = aktuelleRichtung;
     return false;
 }
 
+// Gibt TRUE zurück, wenn die Richtung GERADE NEU nach oben bewegt wurde
 bool Joystick::neueRichtungOben() {
-    int aktuelleRichtung = getYRichtung();
-    
-    if (aktuelleRichtung == -1 && letzteYRichtung != -1) {
-        letzteYRichtung = aktuelleRichtung;
+    if (neueYRichtung == -1) {
+        neueYRichtung = 0;
         return true;
     }
-    
-    letzteYRichtung = aktuelleRichtung;
     return false;
 }
 
+// Gibt TRUE zurück, wenn die Richtung GERADE NEU nach unten bewegt wurde
 bool Joystick::neueRichtungUnten() {
-    int aktuelleRichtung = getYRichtung();
-    
-    if (aktuelleRichtung == 1 && letzteYRichtung != 1) {
-        letzteYRichtung = aktuelleRichtung;
+    if (neueYRichtung == 1) {
+        neueYRichtung = 0;
         return true;
     }
-    
-    letzteYRichtung = aktuelleRichtung;
     return false;
 }
@@ -1,11 +1,13 @@
 #include <Arduino.h>
 #include <FastLED.h>
+#include <PixelBoard.h>
 #include "Joystick.h"
+#include "InputQueue.h"
+#include "FixedTimestep.h"
+#include "TripleBuffer.h"
 #include "SnakeGame.h"
 
-// Hardware
-#define PIN_UNTEN 25
-#define PIN_OBEN 26
+// Hardware (LED-Pins und Panel-Mapping stecken in PixelBoard)
 #define JOY_X 34
 #define JOY_Y 35
 #define JOY_SW 33  // Pin 33 für den Button
@@ -13,127 +15,211 @@
 #define SPIELFELD_BREITE 32
 #define SPIELFELD_HOEHE 16
 
-CRGB ledsUnten[256], ledsOben[256];
 SnakeGame game(SPIELFELD_BREITE, SPIELFELD_HOEHE);
 Joystick joy(JOY_X, JOY_Y, JOY_SW);
 
 enum GameState { STATE_MENU, STATE_PLAYING, STATE_GAMEOVER };
-volatile GameState currentState = STATE_MENU;
+GameState currentState = STATE_MENU;   // gehört dem Game-Task
 
 // Einstellungen
 int menuSelection = 0; 
 int selectedSpeedLevel = 2;
 int selectedFoodAmount = 1;
 
-// Puffer für die nächste Richtung, damit der Input-Task den Game-Task füttert
-volatile Direction nextDirection = DIR_RIGHT; 
-JoystickRichtung letzteMenueRichtung = NEUTRAL;
+// Flanken vom Input-Task zum Game-Task, nichts geht zwischen zwei Spielschritten verloren
+InputQueue<16> inputQueue;
+TaskHandle_t gameTask = NULL;
+
+// Spieltakt ohne Drift, Frame-Zeiten des Display-Tasks
+FixedTimestep spielTakt(400);
+FrameStats frameStats(33000);
+FixedTimestep berichtTakt(10000);
+
+// Alles, was der Display-Task zum Zeichnen braucht, als Kopie vom Game-Task.
+// Der Display-Task liest nie den laufenden Spielzustand.
+struct SpielBild {
+    GameState zustand;
+    uint8_t menuSelection, speedLevel, foodAmount;
+    uint8_t futterAnzahl;
+    Segment futter[MAX_FOOD];
+    uint16_t laenge;
+    Segment schlange[MAX_SNAKE_LENGTH];   // Index 0 ist der Kopf
+};
+
+// Jede sichtbare Änderung wird als neues Bild abgegeben, nur dann wird neu gezeichnet
+TripleBuffer<SpielBild> bilder;
+TaskHandle_t displayTask = NULL;
 
-// --- Mapping Funktionen (unverändert) ---
-int berechneIndexUnten(int x, int y) {
-    int spVonR = 31 - x;
-    return spVonR * 8 + ((spVonR % 2 == 0) ? (7 - y) : y);
-}
-int berechneIndexOben(int x, int y) {
-    return x * 8 + ((x % 2 == 0) ? y : (7 - y));
-}
 void setPixel(int x, int y, CRGB f) {
-    if (x < 0 || x >= 32 || y < 0 || y >= 16) return;
-    if (y < 8) ledsOben[berechneIndexOben(x, y)] = f;
-    else ledsUnten[berechneIndexUnten(x, y - 8)] = f;
+    pixelBoard.setPixel(x, y, f);
 }
 
 // --- Task 1: Input (Sehr schnell!) ---
+// Tastet nur ab und meldet Änderungen, die Auswertung macht der Game-Task
+void sendeEvent(InputEventTyp typ, JoystickRichtung richtung) {
+    if (inputQueue.push({ millis(), typ, richtung })) xTaskNotifyGive(gameTask);
+}
+
 void taskInput(void *pvParameters) {
+    JoystickRichtung letzteRichtung = NEUTRAL;
     while (1) {
         joy.aktualisiere();
         JoystickRichtung dir = joy.getRichtung();
 
-        if (currentState == STATE_MENU) {
-            if (dir != letzteMenueRichtung) {
-                if (dir == OBEN) menuSelection = 0;
-                if (dir == UNTEN) menuSelection = 1;
-                if (menuSelection == 0) {
-                    if (dir == RECHTS && selectedSpeedLevel < 5) selectedSpeedLevel++;
-                    if (dir == LINKS && selectedSpeedLevel > 1) selectedSpeedLevel--;
-                } else {
-                    if (dir == RECHTS && selectedFoodAmount < 5) selectedFoodAmount++;
-                    if (dir == LINKS && selectedFoodAmount > 1) selectedFoodAmount--;
-                }
-                letzteMenueRichtung = dir;
-            }
-            if (joy.wurdeGedrueckt()) {
-                game.reset(selectedFoodAmount);
-                currentState = STATE_PLAYING;
-            }
-        } 
-        else if (currentState == STATE_PLAYING) {
-            if (dir == OBEN) nextDirection = DIR_UP;
-            else if (dir == UNTEN) nextDirection = DIR_DOWN;
-            else if (dir == LINKS) nextDirection = DIR_LEFT;
-            else if (dir == RECHTS) nextDirection = DIR_RIGHT;
+        // Nur neue Richtungen melden, Neutral dazwischen ergibt die nächste Flanke
+        if (dir != letzteRichtung) {
+            if (dir != NEUTRAL) sendeEvent(EVT_RICHTUNG, dir);
+            letzteRichtung = dir;
         }
-        vTaskDelay(pdMS_TO_TICKS(20)); // Check alle 20ms
+        if (joy.wurdeGedrueckt()) sendeEvent(EVT_KURZ, NEUTRAL);
+        if (joy.wurdeLangeGedrueckt()) sendeEvent(EVT_LANG, NEUTRAL);
+
+        vTaskDelay(pdMS_TO_TICKS(1)); // Check jede ms
     }
 }
 
 // --- Task 2: Spiellogik (Variable Geschwindigkeit) ---
+// Aktuellen Zustand in ein Bild kopieren und abgeben, der Game-Task wartet dabei nie
+void neuesBild() {
+    SpielBild &b = bilder.schreibpuffer();
+    b.zustand = currentState;
+    b.menuSelection = menuSelection;
+    b.speedLevel = selectedSpeedLevel;
+    b.foodAmount = selectedFoodAmount;
+    b.futterAnzahl = 0;
+    b.laenge = 0;
+    if (currentState == STATE_PLAYING) {
+        for (int i = 0; i < selectedFoodAmount; i++) {
+            const Point &f = game.getFoodArray()[i];
+            b.futter[b.futterAnzahl++] = { (uint8_t)f.x, (uint8_t)f.y };
+        }
+        for (Segment s : game.getBody()) b.schlange[b.laenge++] = s;
+    }
+    bilder.veroeffentliche();
+    xTaskNotifyGive(displayTask);
+}
+
+void verarbeiteMenueEvent(const InputEvent &e) {
+    if (e.typ == EVT_RICHTUNG) {
+        if (e.richtung == OBEN) menuSelection = 0;
+        if (e.richtung == UNTEN) menuSelection = 1;
+        if (menuSelection == 0) {
+            if (e.richtung == RECHTS && selectedSpeedLevel < 5) selectedSpeedLevel++;
+            if (e.richtung == LINKS && selectedSpeedLevel > 1) selectedSpeedLevel--;
+        } else {
+            if (e.richtung == RECHTS && selectedFoodAmount < 5) selectedFoodAmount++;
+            if (e.richtung == LINKS && selectedFoodAmount > 1) selectedFoodAmount--;
+        }
+    } else if (e.typ == EVT_KURZ) {
+        game.reset(selectedFoodAmount);
+        spielTakt.setStep(400 - (selectedSpeedLevel * 60));
+        spielTakt.start(millis());
+        currentState = STATE_PLAYING;
+    }
+    neuesBild();
+}
+
+// Eine gültige Drehung pro Spielschritt, weitere bleiben für die nächsten
+// Schritte in der Queue (z.B. schnelles Oben-Links für eine Kehre).
+// false bei langem Tastendruck: Spiel abbrechen, zurück ins Menü.
+bool uebernehmeNaechsteDrehung() {
+    InputEvent e;
+    const uint32_t jetzt = millis();
+    while (inputQueue.pop(e)) {
+        if (e.typ == EVT_LANG) return false;
+        if (e.typ != EVT_RICHTUNG) continue;
+        // Länger als zwei Schritte gewartet: gehört zu einer Lage, die es nicht mehr gibt
+        if (jetzt - e.zeit > 2 * spielTakt.getStep()) continue;
+        Direction d = DIR_RIGHT;
+        if (e.richtung == OBEN) d = DIR_UP;
+        else if (e.richtung == UNTEN) d = DIR_DOWN;
+        else if (e.richtung == LINKS) d = DIR_LEFT;
+        if (game.setDirection(d)) return true;
+    }
+    return true;
+}
+
 void taskGameLogic(void *pvParameters) {
+    InputEvent e;
+    neuesBild(); // Menü beim Start
     while (1) {
-        if (currentState == STATE_PLAYING) {
-            game.setDirection(nextDirection);
-            if (!game.update()) currentState = STATE_GAMEOVER;
+        if (currentState == STATE_MENU) {
+            // Menü reagiert sofort: schlafen bis der Input-Task etwas meldet
+            if (inputQueue.pop(e)) verarbeiteMenueEvent(e);
+            else ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+        }
+        else if (currentState == STATE_PLAYING) {
+            // Fällige Schritte abarbeiten und bis zum nächsten schlafen
+            uint8_t schritte = spielTakt.dueSteps(millis());
+            for (uint8_t i = 0; i < schritte && currentState == STATE_PLAYING; i++) {
+                if (!uebernehmeNaechsteDrehung()) currentState = STATE_MENU;
+                else if (!game.update()) currentState = STATE_GAMEOVER;
+            }
+            if (schritte > 0) neuesBild();
+            if (currentState == STATE_PLAYING) {
+                vTaskDelay(pdMS_TO_TICKS(spielTakt.msUntilNextStep(millis())));
+            }
+        }
+        else {
+            // Game-Over-Bild stehen lassen, dann zurück ins Menü
+            vTaskDelay(pdMS_TO_TICKS(1200));
+            while (inputQueue.pop(e)) {} // Eingaben während Game Over verwerfen
+            currentState = STATE_MENU;
+            neuesBild();
         }
-        
-        int speedDelay = 400 - (selectedSpeedLevel * 60);
-        vTaskDelay(pdMS_TO_TICKS(currentState == STATE_PLAYING ? speedDelay : 100));
     }
 }
 
-// --- Task 3: Display (Konstante 30 FPS) ---
+// --- Task 3: Display (nur bei neuem Bild, höchstens ~30 FPS) ---
+// Zeichnet und sendet auf Kern 0, der Spieltakt auf Kern 1 läuft ungebremst weiter
 void taskDisplay(void *pvParameters) {
     while (1) {
-        FastLED.clear();
-        if (currentState == STATE_MENU) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+        if (berichtTakt.dueSteps(millis())) frameStats.report(Serial);
+        if (!bilder.holeNeuestes()) continue; // Bild ist aktuell, kein show()
+        const SpielBild &b = bilder.lesepuffer();
+
+        frameStats.begin();
+        pixelBoard.clear();
+        if (b.zustand == STATE_MENU) {
             // Rahmen im Menü
             for(int x=0; x<32; x++) { setPixel(x,0,CRGB::White); setPixel(x,15,CRGB::White); }
             // Speed Balken (Blau)
-            for(int i=0; i<selectedSpeedLevel; i++) setPixel(8 + i*2, 5, CRGB::Blue);
-            if(menuSelection == 0) setPixel(5, 5, CRGB::White);
+            for(int i=0; i<b.speedLevel; i++) setPixel(8 + i*2, 5, CRGB::Blue);
+            if(b.menuSelection == 0) setPixel(5, 5, CRGB::White);
             // Food Balken (Rot)
-            for(int i=0; i<selectedFoodAmount; i++) setPixel(8 + i*2, 10, CRGB::Red);
-            if(menuSelection == 1) setPixel(5, 10, CRGB::White);
+            for(int i=0; i<b.foodAmount; i++) setPixel(8 + i*2, 10, CRGB::Red);
+            if(b.menuSelection == 1) setPixel(5, 10, CRGB::White);
         } 
-        else if (currentState == STATE_PLAYING) {
+        else if (b.zustand == STATE_PLAYING) {
             // Weißer Rand
             for(int x=0; x<32; x++) { setPixel(x,0,CRGB::White); setPixel(x,15,CRGB::White); }
             for(int y=0; y<16; y++) { setPixel(0,y,CRGB::White); setPixel(31,y,CRGB::White); }
             // Food & Snake
-            for(int i=0; i<selectedFoodAmount; i++) setPixel(game.getFoodArray()[i].x, game.getFoodArray()[i].y, CRGB::Red);
-            Point* b = game.getBody();
-            for(int i=1; i<game.getLength(); i++) setPixel(b[i].x, b[i].y, CRGB::Green);
-            setPixel(b[0].x, b[0].y, CRGB::Lime);
+            for(int i=0; i<b.futterAnzahl; i++) setPixel(b.futter[i].x, b.futter[i].y, CRGB::Red);
+            for(int i=0; i<b.laenge; i++) setPixel(b.schlange[i].x, b.schlange[i].y, CRGB::Green);
+            if (b.laenge > 0) setPixel(b.schlange[0].x, b.schlange[0].y, CRGB::Lime);
         }
-        else if (currentState == STATE_GAMEOVER) {
-            fill_solid(ledsOben, 256, CRGB::Red); fill_solid(ledsUnten, 256, CRGB::Red);
-            FastLED.show();
-            vTaskDelay(pdMS_TO_TICKS(1200));
-            currentState = STATE_MENU;
+        else if (b.zustand == STATE_GAMEOVER) {
+            fill_solid(pixelBoard.leds(), PixelBoard::ANZAHL_LEDS, CRGB::Red);
         }
-        FastLED.show();
-        vTaskDelay(pdMS_TO_TICKS(33)); // ~30 FPS
+        pixelBoard.show();
+        frameStats.end();
+
+        vTaskDelay(pdMS_TO_TICKS(33)); // höchstens ~30 FPS
     }
 }
 
 void setup() {
-    FastLED.addLeds<WS2812, PIN_UNTEN, GRB>(ledsUnten, 256);
-    FastLED.addLeds<WS2812, PIN_OBEN, GRB>(ledsOben, 256);
-    FastLED.setBrightness(20);
+    Serial.begin(115200);
+    game.seed(esp_random());
+    pixelBoard.begin(20);
 
     // Tasks auf die Kerne verteilen
+    // Reihenfolge: wer geweckt wird, muss vor seinem Wecker existieren
+    xTaskCreatePinnedToCore(taskDisplay, "Display", 4096, NULL, 1, &displayTask, 0);
+    xTaskCreatePinnedToCore(taskGameLogic, "Game", 2048, NULL, 2, &gameTask, 1);
     xTaskCreatePinnedToCore(taskInput, "Input", 2048, NULL, 3, NULL, 1);
-    xTaskCreatePinnedToCore(taskGameLogic, "Game", 2048, NULL, 2, NULL, 1);
-    xTaskCreatePinnedToCore(taskDisplay, "Display", 4096, NULL, 1, NULL, 0);
 }
 
 void loop() {}
\ No newline at end of file
@@ -0,0 +1,69 @@
+// Laufzeit des Spielkerns über Millionen Schritte: pio test -e bench
+// Gibt Mittel (mit der Zeitmessung pro Schritt) und schlimmsten Schritt aus,
+// prüft aber keine Zeiten, die hängen vom Rechner und seiner Last ab.
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include "SnakeGame.h"
+
+#define BREITE 32
+#define HOEHE 16
+#define SCHRITTE 5000000UL
+
+// Kreis durch alle Zellen im Rand (30x14), wie in test_snake
+static Direction richtungImKreis(int x, int y) {
+    if (x == 1 && y > 1) return DIR_UP;
+    if (y == 1) return (x < BREITE - 2) ? DIR_RIGHT : DIR_DOWN;
+    if (y % 2 == 0) {
+        if (x > 2) return DIR_LEFT;
+        return (y == HOEHE - 2) ? DIR_LEFT : DIR_DOWN;
+    }
+    return (x < BREITE - 2) ? DIR_RIGHT : DIR_DOWN;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// Ganze Partien im Kreis: von Länge 1 bis zum vollen Feld und dort noch
+// eine Runde weiter, dann neue Partie mit neuem Seed
+void bench_partien_bis_volles_feld() {
+    const int innen = (BREITE - 2) * (HOEHE - 2);
+    SnakeGame game(BREITE, HOEHE);
+    uint32_t partien = 0;
+    unsigned long schritte = 0;
+    long maxNs = 0;
+
+    const auto beginn = std::chrono::steady_clock::now();
+    while (schritte < SCHRITTE) {
+        game.seed(++partien);
+        game.reset(MAX_FOOD);
+        game.setDirection(DIR_DOWN);
+        TEST_ASSERT_TRUE(game.update());
+        int nachVoll = 0;
+        while (nachVoll < innen) {
+            Segment k = game.getBody().head();
+            game.setDirection(richtungImKreis(k.x, k.y));
+            const auto start = std::chrono::steady_clock::now();
+            const bool lebt = game.update();
+            const long ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count();
+            TEST_ASSERT_TRUE(lebt);
+            if (ns > maxNs) maxNs = ns;
+            schritte++;
+            if (game.getLength() == innen) nachVoll++;
+        }
+    }
+    const long long gesamtNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - beginn).count();
+
+    char zeile[160];
+    snprintf(zeile, sizeof(zeile), "%lu Schritte in %lu Partien: %.1f ns/Schritt, schlimmster %ld ns",
+             schritte, (unsigned long)partien, (double)gesamtNs / schritte, maxNs);
+    TEST_MESSAGE(zeile);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(bench_partien_bis_volles_feld);
+    return UNITY_END();
+}
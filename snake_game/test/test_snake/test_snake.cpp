@@ -0,0 +1,139 @@
+// Host-Tests für den Spielkern: pio test -e native
+#include <unity.h>
+#include "SnakeGame.h"
+
+#define BREITE 32
+#define HOEHE 16
+
+// Eingaben wie vom Input-Task: vor Schritt nr die Richtung setzen
+struct Eingabe { uint16_t nr; Direction richtung; };
+
+// Aufgezeichnete Partie: Seed 12345, 3 Futter, 200 Schritte
+static const uint32_t REPLAY_SEED = 12345;
+static const Eingabe replay[] = {
+    {   0, DIR_DOWN },
+    {   1, DIR_RIGHT },
+    {  15, DIR_DOWN },
+    {  16, DIR_LEFT },
+    {  44, DIR_DOWN },
+    {  45, DIR_RIGHT },
+    {  73, DIR_DOWN },
+    {  74, DIR_LEFT },
+    { 102, DIR_DOWN },
+    { 103, DIR_RIGHT },
+    { 131, DIR_DOWN },
+    { 132, DIR_LEFT },
+    { 161, DIR_UP },
+    { 174, DIR_RIGHT },
+};
+static const uint16_t REPLAY_SCHRITTE = 200;
+
+// false, sobald die Schlange stirbt
+static bool spieleReplay(SnakeGame &game) {
+    game.seed(REPLAY_SEED);
+    game.reset(3);
+    uint8_t e = 0;
+    for (uint16_t nr = 0; nr < REPLAY_SCHRITTE; nr++) {
+        while (e < sizeof(replay) / sizeof(replay[0]) && replay[e].nr == nr) {
+            game.setDirection(replay[e++].richtung);
+        }
+        if (!game.update()) return false;
+    }
+    return true;
+}
+
+// Kreis durch alle Zellen im Rand (30x14): Zeile 1 nach rechts, dann
+// Schlangenlinien nach unten, Spalte 1 zurück nach oben
+static Direction richtungImKreis(int x, int y) {
+    if (x == 1 && y > 1) return DIR_UP;
+    if (y == 1) return (x < BREITE - 2) ? DIR_RIGHT : DIR_DOWN;
+    if (y % 2 == 0) {
+        if (x > 2) return DIR_LEFT;
+        return (y == HOEHE - 2) ? DIR_LEFT : DIR_DOWN;
+    }
+    return (x < BREITE - 2) ? DIR_RIGHT : DIR_DOWN;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_replay_ergibt_aufgezeichneten_stand() {
+    SnakeGame game(BREITE, HOEHE);
+    TEST_ASSERT_TRUE(spieleReplay(game));
+
+    // Ein Futter gefressen, Kopf läuft gerade Zeile 1 entlang
+    const SnakeBody<MAX_SNAKE_LENGTH> &body = game.getBody();
+    TEST_ASSERT_EQUAL_INT(4, body.length());
+    for (uint16_t i = 0; i < body.length(); i++) {
+        TEST_ASSERT_EQUAL_INT(27 - i, body[i].x);
+        TEST_ASSERT_EQUAL_INT(1, body[i].y);
+    }
+
+    const Point *futter = game.getFoodArray();
+    TEST_ASSERT_EQUAL_INT(13, futter[0].x);
+    TEST_ASSERT_EQUAL_INT(5, futter[0].y);
+    TEST_ASSERT_EQUAL_INT(17, futter[1].x);
+    TEST_ASSERT_EQUAL_INT(9, futter[1].y);
+    TEST_ASSERT_EQUAL_INT(23, futter[2].x);
+    TEST_ASSERT_EQUAL_INT(8, futter[2].y);
+}
+
+void test_gleicher_seed_gleicher_verlauf() {
+    SnakeGame a(BREITE, HOEHE), b(BREITE, HOEHE);
+    TEST_ASSERT_TRUE(spieleReplay(a));
+    TEST_ASSERT_TRUE(spieleReplay(b));
+    TEST_ASSERT_EQUAL_INT(a.getLength(), b.getLength());
+    for (uint16_t i = 0; i < a.getBody().length(); i++) {
+        TEST_ASSERT_EQUAL_INT(a.getBody()[i].x, b.getBody()[i].x);
+        TEST_ASSERT_EQUAL_INT(a.getBody()[i].y, b.getBody()[i].y);
+    }
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(a.getFoodArray()[i].x, b.getFoodArray()[i].x);
+        TEST_ASSERT_EQUAL_INT(a.getFoodArray()[i].y, b.getFoodArray()[i].y);
+    }
+}
+
+void test_keine_umkehr() {
+    SnakeGame game(BREITE, HOEHE);
+    TEST_ASSERT_FALSE(game.setDirection(DIR_LEFT));   // läuft nach rechts
+    TEST_ASSERT_FALSE(game.setDirection(DIR_RIGHT));  // keine Änderung
+    TEST_ASSERT_TRUE(game.setDirection(DIR_UP));
+}
+
+// Schlimmster Fall für update() und spawnFood(): fast volles Feld, Futter
+// muss unter wenigen freien Zellen gezogen werden. Die Laufzeit misst
+// bench_snake (pio test -e bench), hier zählt nur der Zustand.
+void test_schritt_auf_fast_vollem_feld() {
+    SnakeGame game(BREITE, HOEHE, 7);
+    game.reset(MAX_FOOD);
+    const int innen = (BREITE - 2) * (HOEHE - 2);
+
+    // Auf den Kreis einbiegen und ihm folgen, bis fast alles belegt ist
+    game.setDirection(DIR_DOWN);
+    TEST_ASSERT_TRUE(game.update());
+    uint32_t schritte = 0;
+    while (game.getLength() < innen - MAX_FOOD && schritte < 200000) {
+        Segment k = game.getBody().head();
+        game.setDirection(richtungImKreis(k.x, k.y));
+        TEST_ASSERT_TRUE(game.update());
+        schritte++;
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL(innen - MAX_FOOD, game.getLength());
+
+    // Weiter im Kreis, bis das Feld ganz voll ist
+    for (int i = 0; i < 5 * innen; i++) {
+        Segment k = game.getBody().head();
+        game.setDirection(richtungImKreis(k.x, k.y));
+        TEST_ASSERT_TRUE(game.update());
+    }
+    TEST_ASSERT_EQUAL_INT(innen, game.getLength());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_replay_ergibt_aufgezeichneten_stand);
+    RUN_TEST(test_gleicher_seed_gleicher_verlauf);
+    RUN_TEST(test_keine_umkehr);
+    RUN_TEST(test_schritt_auf_fast_vollem_feld);
+    return UNITY_END();
+}